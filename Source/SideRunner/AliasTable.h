@@ -0,0 +1,110 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Walker/Vose alias table for O(1) sampling from a discrete weighted distribution.
+ * Build once from designer weights, then sample with a single 32-bit random value.
+ *
+ * PERFORMANCE: Sampling is one multiply, one compare and two array reads regardless
+ * of the number of options. Immutable after Build — safe to share across worker threads.
+ */
+struct FAliasTable
+{
+    /**
+     * Builds the table from relative weights. Negative weights count as zero;
+     * if every weight is zero the distribution falls back to uniform.
+     *
+     * @param Weights - Relative weight per option
+     */
+    void Build(TArrayView<const float> Weights)
+    {
+        const int32 Num = Weights.Num();
+        Probability.SetNumUninitialized(Num);
+        Alias.SetNumUninitialized(Num);
+
+        if (Num == 0)
+        {
+            return;
+        }
+
+        double TotalWeight = 0.0;
+        for (const float Weight : Weights)
+        {
+            TotalWeight += FMath::Max(0.0f, Weight);
+        }
+
+        // Scale weights so the average column holds exactly 1.0
+        TArray<double, TInlineAllocator<16>> Scaled;
+        Scaled.SetNumUninitialized(Num);
+        for (int32 i = 0; i < Num; ++i)
+        {
+            Scaled[i] = TotalWeight > 0.0 ? FMath::Max(0.0f, Weights[i]) * Num / TotalWeight : 1.0;
+        }
+
+        TArray<int32, TInlineAllocator<16>> Small;
+        TArray<int32, TInlineAllocator<16>> Large;
+        for (int32 i = 0; i < Num; ++i)
+        {
+            (Scaled[i] < 1.0 ? Small : Large).Add(i);
+        }
+
+        // Pair each under-full column with an over-full one that tops it up
+        while (Small.Num() > 0 && Large.Num() > 0)
+        {
+            const int32 Less = Small.Pop();
+            const int32 More = Large.Pop();
+
+            Probability[Less] = static_cast<float>(Scaled[Less]);
+            Alias[Less] = More;
+
+            Scaled[More] = (Scaled[More] + Scaled[Less]) - 1.0;
+            (Scaled[More] < 1.0 ? Small : Large).Add(More);
+        }
+
+        // Leftovers are full columns (only off by floating-point error)
+        for (const int32 Index : Large)
+        {
+            Probability[Index] = 1.0f;
+            Alias[Index] = Index;
+        }
+        for (const int32 Index : Small)
+        {
+            Probability[Index] = 1.0f;
+            Alias[Index] = Index;
+        }
+    }
+
+    /**
+     * Samples an option index.
+     *
+     * @param RandomBits - Uniformly distributed 32-bit value
+     * @return Option index in [0, Num()), or INDEX_NONE if the table is empty
+     */
+    FORCEINLINE int32 Sample(uint32 RandomBits) const
+    {
+        if (Probability.Num() == 0)
+        {
+            return INDEX_NONE;
+        }
+
+        // High word picks the column, low word is the in-column coin flip
+        const uint64 Scaled = static_cast<uint64>(RandomBits) * static_cast<uint64>(Probability.Num());
+        const int32 Column = static_cast<int32>(Scaled >> 32);
+        const float Coin = static_cast<float>(static_cast<uint32>(Scaled)) * (1.0f / 4294967296.0f);
+        return Coin < Probability[Column] ? Column : Alias[Column];
+    }
+
+    /** Returns the number of options in the table. */
+    FORCEINLINE int32 Num() const
+    {
+        return Probability.Num();
+    }
+
+private:
+    /** Chance of keeping the column's own index */
+    TArray<float> Probability;
+
+    /** Index returned when the coin flip fails */
+    TArray<int32> Alias;
+};
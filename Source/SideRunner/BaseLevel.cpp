@@ -3,6 +3,7 @@
 #include "SideRunner.h" // Custom log categories
 #include "Engine/World.h"
 #include "GameFramework/Character.h"
+#include "Physics/Experimental/PhysScene_Chaos.h"
 
 #if WITH_EDITOR
 #include "DrawDebugHelpers.h"
@@ -13,7 +14,11 @@ ABaseLevel::ABaseLevel()
     : LevelLength(1000.0f)
     , DifficultyLevel(1)
     , bIsEndLevel(false)
+    , DormancyMode(EChunkDormancyMode::PerActor)
     , bShowDebugBoxes(false)
+    , bIsDormant(false)
+    , ProxyCoinBlock(INDEX_NONE)
+    , RegisteredCoinCount(0)
 {
     // PERFORMANCE: Disable tick by default - only enable when debug visualization is needed
     PrimaryActorTick.bCanEverTick = false;
@@ -159,20 +164,23 @@ UBoxComponent* ABaseLevel::GetSpawnLocation() const
     return SpawnLocation;
 }
 
-void ABaseLevel::ActivateLevel()
+void ABaseLevel::SetTriggerEnabled(bool bEnabled)
 {
-    // PERFORMANCE: Use range-based for loop and validate actors
-    int32 ActivatedCount = 0;
-    for (AActor* Actor : LevelActors)
+    if (Trigger)
     {
-        if (IsValid(Actor))
-        {
-            Actor->SetActorHiddenInGame(false);
-            Actor->SetActorEnableCollision(true);
-            Actor->SetActorTickEnabled(true);
-            ActivatedCount++;
-        }
+        Trigger->SetGenerateOverlapEvents(bEnabled);
+        Trigger->SetCollisionEnabled(bEnabled ? ECollisionEnabled::QueryOnly : ECollisionEnabled::NoCollision);
     }
+}
+
+void ABaseLevel::ActivateLevel()
+{
+    // After DeactivateLevel restore exactly what was there; otherwise show everything, as before
+    const int32 ActivatedCount = bIsDormant
+        ? WakeActors(SleepingActorStates)
+        : SetActorsDormant(LevelActors, false, EChunkDormancyMode::PerActor);
+    SleepingActorStates.Reset();
+    bIsDormant = false;
 
 #if UE_BUILD_DEVELOPMENT
     UE_LOG(LogSideRunner, Log, TEXT("Level %s activated %d actors"), *GetName(), ActivatedCount);
@@ -181,24 +189,159 @@ void ABaseLevel::ActivateLevel()
 
 void ABaseLevel::DeactivateLevel()
 {
-    // PERFORMANCE: Use range-based for loop and validate actors
-    int32 DeactivatedCount = 0;
-    for (AActor* Actor : LevelActors)
+    // Already asleep: re-capturing now would record the sleeping state
+    if (bIsDormant)
     {
-        if (IsValid(Actor))
-        {
-            Actor->SetActorHiddenInGame(true);
-            Actor->SetActorEnableCollision(false);
-            Actor->SetActorTickEnabled(false);
-            DeactivatedCount++;
-        }
+        return;
     }
 
+    const int32 DeactivatedCount = SleepActors(LevelActors, DormancyMode, SleepingActorStates);
+    bIsDormant = true;
+
 #if UE_BUILD_DEVELOPMENT
     UE_LOG(LogSideRunner, Log, TEXT("Level %s deactivated %d actors"), *GetName(), DeactivatedCount);
 #endif
 }
 
+int32 ABaseLevel::SetActorsDormant(TArrayView<AActor* const> Actors, bool bDormant, EChunkDormancyMode Mode)
+{
+    int32 ChangedCount = 0;
+    UWorld* WokenWorld = nullptr;
+
+    for (AActor* Actor : Actors)
+    {
+        if (!IsValid(Actor))
+        {
+            continue;
+        }
+
+        Actor->SetActorHiddenInGame(bDormant);
+        Actor->SetActorTickEnabled(!bDormant);
+
+        if (bDormant)
+        {
+            // PerActor: collision flag (filter and overlap updates per component). Bulk: drop the bodies.
+            if (Mode == EChunkDormancyMode::PerActor)
+            {
+                Actor->SetActorEnableCollision(false);
+            }
+            else
+            {
+                DestroyPhysicsBodies(Actor);
+            }
+        }
+        else
+        {
+            // Both modes recreate missing bodies, so wake is safe whichever mode put the actor to sleep
+            Actor->SetActorEnableCollision(true);
+            DeferPhysicsBodies(Actor);
+            WokenWorld = Actor->GetWorld();
+        }
+        ChangedCount++;
+    }
+
+    FlushDeferredPhysicsBodies(WokenWorld);
+    return ChangedCount;
+}
+
+int32 ABaseLevel::SleepActors(TArrayView<AActor* const> Actors, EChunkDormancyMode Mode, TArray<FActorDormancyState>& OutSavedStates)
+{
+    OutSavedStates.Reset(Actors.Num());
+    for (AActor* Actor : Actors)
+    {
+        if (!IsValid(Actor))
+        {
+            continue;
+        }
+
+        FActorDormancyState& State = OutSavedStates.AddDefaulted_GetRef();
+        State.Actor = Actor;
+        State.bHidden = Actor->IsHidden();
+        State.bCollisionEnabled = Actor->GetActorEnableCollision();
+        State.bTickEnabled = Actor->IsActorTickEnabled();
+
+        Actor->SetActorHiddenInGame(true);
+        Actor->SetActorTickEnabled(false);
+        if (Mode == EChunkDormancyMode::PerActor)
+        {
+            Actor->SetActorEnableCollision(false);
+        }
+        else
+        {
+            DestroyPhysicsBodies(Actor);
+        }
+    }
+
+    return OutSavedStates.Num();
+}
+
+int32 ABaseLevel::WakeActors(TArrayView<const FActorDormancyState> SavedStates)
+{
+    int32 RestoredCount = 0;
+    UWorld* WokenWorld = nullptr;
+
+    for (const FActorDormancyState& State : SavedStates)
+    {
+        AActor* Actor = State.Actor.Get();
+        if (!IsValid(Actor))
+        {
+            continue;
+        }
+
+        if (Actor->IsHidden() != State.bHidden)
+        {
+            Actor->SetActorHiddenInGame(State.bHidden);
+        }
+        if (Actor->GetActorEnableCollision() != State.bCollisionEnabled)
+        {
+            Actor->SetActorEnableCollision(State.bCollisionEnabled);
+        }
+        Actor->SetActorTickEnabled(State.bTickEnabled);
+
+        // Only primitives that should collide get a body back (ShouldCreatePhysicsState checks)
+        DeferPhysicsBodies(Actor);
+        WokenWorld = Actor->GetWorld();
+        RestoredCount++;
+    }
+
+    FlushDeferredPhysicsBodies(WokenWorld);
+    return RestoredCount;
+}
+
+void ABaseLevel::DestroyPhysicsBodies(AActor* Actor)
+{
+    TInlineComponentArray<UPrimitiveComponent*> Primitives(Actor);
+    for (UPrimitiveComponent* Primitive : Primitives)
+    {
+        if (Primitive->IsPhysicsStateCreated())
+        {
+            Primitive->DestroyPhysicsState();
+        }
+    }
+}
+
+void ABaseLevel::DeferPhysicsBodies(AActor* Actor)
+{
+    TInlineComponentArray<UPrimitiveComponent*> Primitives(Actor);
+    for (UPrimitiveComponent* Primitive : Primitives)
+    {
+        if (Primitive->IsRegistered() && !Primitive->IsPhysicsStateCreated())
+        {
+            // Deferred: queued on the physics scene and created with the rest of the chunk
+            Primitive->CreatePhysicsState(/*bAllowDeferral=*/ true);
+        }
+    }
+}
+
+void ABaseLevel::FlushDeferredPhysicsBodies(UWorld* World)
+{
+    // PERFORMANCE: One batched body creation for everything woken in this pass
+    if (FPhysScene* PhysScene = World ? World->GetPhysicsScene() : nullptr)
+    {
+        PhysScene->ProcessDeferredCreatePhysicsState();
+    }
+}
+
 float ABaseLevel::GetLevelLength() const
 {
     return LevelLength;
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "EndlessRunnerTypes.h"
 #include "BaseLevel.generated.h"
 
 class UBoxComponent;
@@ -11,6 +12,18 @@ class UBoxComponent;
  */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnLevelTriggered, class ABaseLevel*, TriggeredLevel);
 
+/**
+ * An actor's visibility, collision and tick state, captured when it is put to sleep so
+ * waking restores exactly that (e.g. collected coins stay hidden, retired spikes stay idle).
+ */
+struct FActorDormancyState
+{
+    TWeakObjectPtr<AActor> Actor;
+    bool bHidden = false;
+    bool bCollisionEnabled = true;
+    bool bTickEnabled = true;
+};
+
 /**
  * Performance-optimized BaseLevel for procedurally generated side-scrolling levels.
  * Features efficient trigger detection and actor management for level streaming.
@@ -43,6 +56,13 @@ public:
     
     UFUNCTION(BlueprintCallable, BlueprintPure, Category="Level Generation")
     UBoxComponent* GetSpawnLocation() const;
+
+    /**
+     * Enables or disables the trigger box. Disabled triggers have no collision,
+     * so they drop out of the physics broadphase entirely.
+     */
+    UFUNCTION(BlueprintCallable, Category="Level Generation")
+    void SetTriggerEnabled(bool bEnabled);
     
     // PERFORMANCE: Level management
     UFUNCTION(BlueprintCallable, Category="Level Generation")
@@ -50,6 +70,40 @@ public:
     
     UFUNCTION(BlueprintCallable, Category="Level Generation")
     void DeactivateLevel();
+
+    /** True while the level's actors are asleep (after DeactivateLevel). */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category="Level Generation")
+    bool IsLevelDormant() const { return bIsDormant; }
+
+    /**
+     * Puts a whole chunk's actors to sleep or wakes them in a single pass, for pooling.
+     * Wake is always safe regardless of which mode put the actors to sleep, and leaves every actor
+     * visible, collidable and ticking (pooled actors are reset for reuse).
+     *
+     * @param Actors - Actors to change
+     * @param bDormant - True to sleep, false to wake
+     * @param Mode - How collision is switched off on sleep (see EChunkDormancyMode)
+     * @return Number of valid actors changed
+     */
+    static int32 SetActorsDormant(TArrayView<AActor* const> Actors, bool bDormant, EChunkDormancyMode Mode);
+
+    /**
+     * Puts actors to sleep, recording the state each one had so WakeActors can restore it.
+     *
+     * @param Actors - Actors to put to sleep
+     * @param Mode - How collision is switched off (see EChunkDormancyMode)
+     * @param OutSavedStates - Receives one entry per valid actor (replaces previous contents)
+     * @return Number of valid actors changed
+     */
+    static int32 SleepActors(TArrayView<AActor* const> Actors, EChunkDormancyMode Mode, TArray<FActorDormancyState>& OutSavedStates);
+
+    /**
+     * Wakes actors put to sleep by SleepActors, restoring exactly their recorded state.
+     *
+     * @param SavedStates - States recorded by SleepActors
+     * @return Number of actors still alive and restored
+     */
+    static int32 WakeActors(TArrayView<const FActorDormancyState> SavedStates);
     
     // PERFORMANCE: Property accessors
     UFUNCTION(BlueprintCallable, BlueprintPure, Category="Level Generation")
@@ -77,6 +131,24 @@ public:
     UFUNCTION(BlueprintCallable, Category="Level Generation")
     void SetDifficultyLevel(int32 InDifficulty);
 
+    /** Set the proxy coin block owned by this level (INDEX_NONE if its coins are actors). */
+    void SetProxyCoinBlock(int32 InCoinBlock) { ProxyCoinBlock = InCoinBlock; }
+
+    /** Set the number of coins this level registered with the coin registry (handcrafted levels). */
+    void SetRegisteredCoinCount(int32 InNumCoins) { RegisteredCoinCount = InNumCoins; }
+
+    /** Returns the number of coins this level registered, to unregister when it is recycled. */
+    int32 GetRegisteredCoinCount() const { return RegisteredCoinCount; }
+
+    /** Set how DeactivateLevel puts this level's actors to sleep. */
+    void SetDormancyMode(EChunkDormancyMode InMode) { DormancyMode = InMode; }
+
+    /** Returns the proxy coin block owned by this level, or INDEX_NONE. */
+    int32 GetProxyCoinBlock() const { return ProxyCoinBlock; }
+
+    /** Returns the actors that make up this level. */
+    const TArray<AActor*>& GetLevelActors() const { return LevelActors; }
+
     /** Returns level actors to caller for pool management, then clears internal array. */
     UFUNCTION(BlueprintCallable, Category="Level Generation")
     TArray<AActor*> CleanupLevelActors();
@@ -108,13 +180,38 @@ protected:
     UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Level Generation")
     bool bIsEndLevel;
 
+    /** How DeactivateLevel puts actors to sleep (procedural chunks use the builder's mode). */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Level Generation")
+    EChunkDormancyMode DormancyMode;
+
 private:
     // PERFORMANCE: Debug visualization (editor only)
     UPROPERTY(EditAnywhere, Category="Debug", meta=(DisplayName="Show Debug Boxes"))
     bool bShowDebugBoxes;
+
+    /** True between DeactivateLevel and the next ActivateLevel. */
+    bool bIsDormant;
+
+    /** Actor state recorded by DeactivateLevel and restored by ActivateLevel */
+    TArray<FActorDormancyState> SleepingActorStates;
+
+    /** Handle of this level's coins in the builder's proxy coin field. */
+    int32 ProxyCoinBlock;
+
+    /** Coins registered on behalf of this level by ASpawnLevel (0 for procedural chunks). */
+    int32 RegisteredCoinCount;
     
     // PERFORMANCE: Helper functions
     void ValidateLevelActors();
+
+    /** Bulk dormancy: removes the physics bodies of an actor's primitives, leaving collision settings alone. */
+    static void DestroyPhysicsBodies(AActor* Actor);
+
+    /** Queues body creation for an actor's primitives that should collide but have no body. */
+    static void DeferPhysicsBodies(AActor* Actor);
+
+    /** Creates every queued body in one batch. */
+    static void FlushDeferredPhysicsBodies(UWorld* World);
     
 #if WITH_EDITOR
     void DrawDebugVisualization();
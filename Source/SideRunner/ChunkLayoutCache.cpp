@@ -0,0 +1,95 @@
+#include "ChunkLayoutCache.h"
+
+const FChunkLayout* FChunkLayoutCache::FindAndTouch(const FChunkLayoutKey& Key)
+{
+    FEntry* Entry = Entries.Find(Key);
+    if (!Entry)
+    {
+        Misses++;
+        return nullptr;
+    }
+
+    // Move to head without reallocating the node
+    RecencyList.RemoveNode(Entry->RecencyNode, false);
+    RecencyList.AddHead(Entry->RecencyNode);
+
+    Hits++;
+    return &Entry->Layout;
+}
+
+void FChunkLayoutCache::Add(const FChunkLayoutKey& Key, const FChunkLayout& Layout)
+{
+    const SIZE_T Bytes = GetLayoutSize(Layout);
+    if (Bytes > MaxBytes)
+    {
+        return; // Would never fit (also covers MaxBytes == 0)
+    }
+
+    if (FEntry* Existing = Entries.Find(Key))
+    {
+        AllocatedBytes -= Existing->Bytes;
+        RecencyList.RemoveNode(Existing->RecencyNode);
+        Entries.Remove(Key);
+    }
+
+    RecencyList.AddHead(Key);
+
+    FEntry& Entry = Entries.Add(Key);
+    Entry.Layout = Layout;
+    Entry.Bytes = Bytes;
+    Entry.RecencyNode = RecencyList.GetHead();
+    AllocatedBytes += Bytes;
+
+    EvictToFit();
+}
+
+void FChunkLayoutCache::SetMaxBytes(SIZE_T InMaxBytes)
+{
+    MaxBytes = InMaxBytes;
+    EvictToFit();
+}
+
+void FChunkLayoutCache::Empty()
+{
+    Entries.Empty();
+    RecencyList.Empty();
+    AllocatedBytes = 0;
+}
+
+FChunkLayoutCacheStats FChunkLayoutCache::GetStats() const
+{
+    FChunkLayoutCacheStats Stats;
+    Stats.Hits = Hits;
+    Stats.Misses = Misses;
+    Stats.Evictions = Evictions;
+    Stats.NumEntries = Entries.Num();
+    Stats.AllocatedBytes = AllocatedBytes;
+    return Stats;
+}
+
+SIZE_T FChunkLayoutCache::GetLayoutSize(const FChunkLayout& Layout)
+{
+    return sizeof(FEntry) + sizeof(FChunkLayoutKey)
+        + sizeof(TDoubleLinkedList<FChunkLayoutKey>::TDoubleLinkedListNode)
+        + Layout.Platforms.GetAllocatedSize()
+        + Layout.Obstacles.GetAllocatedSize()
+        + Layout.Enemies.GetAllocatedSize()
+        + Layout.Coins.GetAllocatedSize();
+}
+
+void FChunkLayoutCache::EvictToFit()
+{
+    while (AllocatedBytes > MaxBytes && RecencyList.Num() > 0)
+    {
+        TDoubleLinkedList<FChunkLayoutKey>::TDoubleLinkedListNode* Tail = RecencyList.GetTail();
+        const FChunkLayoutKey OldestKey = Tail->GetValue();
+
+        if (const FEntry* Oldest = Entries.Find(OldestKey))
+        {
+            AllocatedBytes -= Oldest->Bytes;
+        }
+        Entries.Remove(OldestKey);
+        RecencyList.RemoveNode(Tail);
+        Evictions++;
+    }
+}
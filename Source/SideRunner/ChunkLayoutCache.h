@@ -0,0 +1,107 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/List.h"
+#include "EndlessRunnerTypes.h"
+
+/**
+ * Identifies a generated chunk layout: the same key always produces the same layout.
+ */
+struct FChunkLayoutKey
+{
+    int32 Seed = 0;
+    int32 ChunkIndex = 0;
+    int32 DifficultyBucket = 0;
+    uint32 ConfigHash = 0;
+
+    bool operator==(const FChunkLayoutKey& Other) const
+    {
+        return Seed == Other.Seed
+            && ChunkIndex == Other.ChunkIndex
+            && DifficultyBucket == Other.DifficultyBucket
+            && ConfigHash == Other.ConfigHash;
+    }
+
+    friend uint32 GetTypeHash(const FChunkLayoutKey& Key)
+    {
+        uint32 Hash = GetTypeHash(Key.Seed);
+        Hash = HashCombine(Hash, GetTypeHash(Key.ChunkIndex));
+        Hash = HashCombine(Hash, GetTypeHash(Key.DifficultyBucket));
+        return HashCombine(Hash, Key.ConfigHash);
+    }
+};
+
+/** Hit/miss counters and footprint of an FChunkLayoutCache. */
+struct FChunkLayoutCacheStats
+{
+    int32 Hits = 0;
+    int32 Misses = 0;
+    int32 Evictions = 0;
+    int32 NumEntries = 0;
+    SIZE_T AllocatedBytes = 0;
+};
+
+/**
+ * Memory-capped LRU cache of chunk layouts.
+ * Lets respawns and replays reuse layouts instead of regenerating them.
+ *
+ * PERFORMANCE: O(1) lookup, touch and eviction (hash map + intrusive recency list).
+ * Not thread-safe — owned and used on the game thread by UProceduralLevelBuilder.
+ */
+class FChunkLayoutCache
+{
+public:
+    /**
+     * Returns the cached layout for Key and marks it most recently used, or nullptr on miss.
+     *
+     * @param Key - Layout key to look up
+     * @return Cached layout (valid until the next Add/Empty) or nullptr
+     */
+    const FChunkLayout* FindAndTouch(const FChunkLayoutKey& Key);
+
+    /**
+     * Inserts a layout as most recently used, evicting least recently used
+     * entries until the cache fits within MaxBytes.
+     *
+     * @param Key - Layout key
+     * @param Layout - Layout to store (copied)
+     */
+    void Add(const FChunkLayoutKey& Key, const FChunkLayout& Layout);
+
+    /** True if Key is cached. Does not touch recency or count as a hit. */
+    bool Contains(const FChunkLayoutKey& Key) const { return Entries.Contains(Key); }
+
+    /** Sets the memory cap in bytes (0 disables caching) and evicts down to it. */
+    void SetMaxBytes(SIZE_T InMaxBytes);
+
+    /** Removes all entries. Stats counters are preserved. */
+    void Empty();
+
+    /** Returns a snapshot of hit/miss counters and current footprint. */
+    FChunkLayoutCacheStats GetStats() const;
+
+    /** Estimated heap footprint of one cached layout, including bookkeeping. */
+    static SIZE_T GetLayoutSize(const FChunkLayout& Layout);
+
+private:
+    struct FEntry
+    {
+        FChunkLayout Layout;
+        SIZE_T Bytes = 0;
+        TDoubleLinkedList<FChunkLayoutKey>::TDoubleLinkedListNode* RecencyNode = nullptr;
+    };
+
+    void EvictToFit();
+
+    TMap<FChunkLayoutKey, FEntry> Entries;
+
+    /** Head = most recently used, tail = next to evict. */
+    TDoubleLinkedList<FChunkLayoutKey> RecencyList;
+
+    SIZE_T MaxBytes = 256 * 1024;
+    SIZE_T AllocatedBytes = 0;
+
+    int32 Hits = 0;
+    int32 Misses = 0;
+    int32 Evictions = 0;
+};
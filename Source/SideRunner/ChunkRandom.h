@@ -0,0 +1,93 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Identifies which generation decision a random draw feeds.
+ * Each purpose is an independent sub-stream, so adding a draw for one feature
+ * never shifts the results of another.
+ *
+ * NOTE: Append new purposes at the end — reordering changes every generated layout.
+ */
+enum class EChunkRandomPurpose : uint8
+{
+    PlatformWidth,
+    PlatformHeight,
+    PlatformMoving,
+    PlatformCollectible,
+    PlatformLength,
+    PlatformVariant,
+    GapSize,
+    ObstacleChance,
+    ObstacleClass,
+    ObstacleMovement,
+    WallSpikeChance,
+    WallSpikePlacement,
+    CoinArcChance,
+    EnemyChance,
+    PlatformMotionPhase,
+    PatternSelect
+};
+
+/**
+ * Counter-based random generator for procedural chunk generation.
+ * Every draw is a pure hash of (Seed, ChunkIndex, ElementIndex, Purpose) rather than
+ * the next value of a sequential stream, so draws can be taken in any order.
+ *
+ * PERFORMANCE: Stateless and const — safe to share across worker threads, and lets
+ * chunks and elements be laid out in parallel or out of order with identical results.
+ */
+struct FChunkRandom
+{
+    FChunkRandom(int32 InSeed, int32 InChunkIndex)
+        : ChunkKey(Mix64((static_cast<uint64>(static_cast<uint32>(InSeed)) << 32) | static_cast<uint32>(InChunkIndex)))
+    {
+    }
+
+    /** Returns 32 well-mixed random bits for the given element and purpose. */
+    FORCEINLINE uint32 GetBits(int32 ElementIndex, EChunkRandomPurpose Purpose) const
+    {
+        const uint64 Counter = (static_cast<uint64>(static_cast<uint32>(ElementIndex)) << 8) | static_cast<uint8>(Purpose);
+        return static_cast<uint32>(Mix64(ChunkKey ^ Counter) >> 32);
+    }
+
+    /** Returns a float in [0, 1). */
+    FORCEINLINE float FRand(int32 ElementIndex, EChunkRandomPurpose Purpose) const
+    {
+        // Top 24 bits map exactly onto the float mantissa
+        return static_cast<float>(GetBits(ElementIndex, Purpose) >> 8) * (1.0f / 16777216.0f);
+    }
+
+    /** Returns a float in [Min, Max). */
+    FORCEINLINE float FRandRange(int32 ElementIndex, EChunkRandomPurpose Purpose, float Min, float Max) const
+    {
+        return Min + (Max - Min) * FRand(ElementIndex, Purpose);
+    }
+
+    /** Returns an integer in [Min, Max] (inclusive, matching FRandomStream::RandRange). */
+    FORCEINLINE int32 RandRange(int32 ElementIndex, EChunkRandomPurpose Purpose, int32 Min, int32 Max) const
+    {
+        const int64 Range = static_cast<int64>(Max) - Min + 1;
+        if (Range <= 1)
+        {
+            return Min;
+        }
+        // Multiply-shift avoids the modulo bias of Bits % Range
+        return Min + static_cast<int32>((static_cast<uint64>(GetBits(ElementIndex, Purpose)) * static_cast<uint64>(Range)) >> 32);
+    }
+
+private:
+    /** SplitMix64 finalizer: full avalanche so adjacent counters give unrelated outputs. */
+    static FORCEINLINE uint64 Mix64(uint64 X)
+    {
+        X ^= X >> 30;
+        X *= 0xBF58476D1CE4E5B9ull;
+        X ^= X >> 27;
+        X *= 0x94D049BB133111EBull;
+        X ^= X >> 31;
+        return X;
+    }
+
+    /** Pre-mixed (Seed, ChunkIndex) key shared by every draw in this chunk. */
+    uint64 ChunkKey;
+};
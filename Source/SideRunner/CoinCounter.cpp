@@ -1,7 +1,10 @@
 #include "CoinCounter.h"
 #include "Kismet/GameplayStatics.h"
 #include "CoinPickup.h"
+#include "CoinPoolSubsystem.h"
+#include "ProgressSaveSubsystem.h"
 #include "Engine/World.h"
+#include "Engine/GameInstance.h"
 #include "EngineUtils.h"
 #include "SideRunner.h" // Custom log categories
 
@@ -35,22 +38,19 @@ void UCoinCounter::BeginPlay()
 {
     Super::BeginPlay();
 
-    // CRITICAL FIX: Use thread-safe initialization
     if (bIsInitialized)
     {
         UE_LOG(LogSideRunnerScoring, Warning, TEXT("CoinCounter already initialized, preventing duplicate initialization"));
         return;
     }
 
-    // HOTFIX: Force reset at game start with thread safety
-    {
-        FScopeLock Lock(&CoinMutex);
-        CoinCount = 0;
-        CollectedCoins.Empty();
-        bProcessingCoin = false;
-        ReachedMilestones.Empty();
-        bIsInitialized = true;
-    }
+    // HOTFIX: Force reset at game start
+    FPlatformAtomics::AtomicStore(&CoinCount, 0);
+    CollectedCoinBits.Empty();
+    CollectedCoinGenerations.Empty();
+    bProcessingCoin = false;
+    ReachedMilestones.Empty();
+    bIsInitialized = true;
 
     // Log initial state - helps with debugging
     UE_LOG(LogSideRunnerScoring, Log, TEXT("CoinCounter RESET to %d coins"), CoinCount);
@@ -65,16 +65,13 @@ void UCoinCounter::BeginPlay()
             UCoinCounter* CoinCounter = WeakThis.Get();
             if (CoinCounter)
             {
-                int32 CurrentCount;
-                {
-                    FScopeLock Lock(&CoinCounter->CoinMutex);
-                    CurrentCount = CoinCounter->CoinCount;
-                }
-                CoinCounter->OnCoinsUpdated.Broadcast(CurrentCount);
+                CoinCounter->OnCoinsUpdated.Broadcast(CoinCounter->GetCurrentCoinCount());
             }
         }, 0.1f, false);  // Delay broadcast by 0.1 seconds
     }
 
+    CoinRegistry = GetWorld() ? GetWorld()->GetSubsystem<UCoinPoolSubsystem>() : nullptr;
+
     // Count total coins in the level if auto-counting is enabled
     if (bAutoCountCoinsInLevel)
     {
@@ -101,40 +98,50 @@ void UCoinCounter::TickComponent(float DeltaTime, ELevelTick TickType, FActorCom
 
 bool UCoinCounter::HasCollectedCoin(AActor* CoinActor) const
 {
-    if (!CoinActor)
+    const ACoinPickup* Coin = Cast<ACoinPickup>(CoinActor);
+    if (!Coin)
     {
         return false;
     }
-    
-    // Thread-safe access
-    FScopeLock Lock(&CoinMutex);
-    return CollectedCoins.Contains(CoinActor);
+
+    // PERFORMANCE: One bit test and one compare, regardless of how many coins were collected
+    const FCoinId Id = Coin->GetCoinId();
+    return Id.IsValid()
+        && Id.Index < CollectedCoinBits.Num()
+        && CollectedCoinBits[Id.Index]
+        && CollectedCoinGenerations[Id.Index] == Id.Generation;
 }
 
 void UCoinCounter::MarkCoinAsCollected(AActor* CoinActor)
 {
-    if (!CoinActor)
+    const ACoinPickup* Coin = Cast<ACoinPickup>(CoinActor);
+    if (!Coin || !Coin->GetCoinId().IsValid())
     {
         return;
     }
-    
-    // Thread-safe access
-    FScopeLock Lock(&CoinMutex);
-    
+
     // Prevent duplicate marking
-    if (CollectedCoins.Contains(CoinActor))
+    if (HasCollectedCoin(CoinActor))
     {
         UE_LOG(LogSideRunnerScoring, Warning, TEXT("Coin %s already marked as collected"), *CoinActor->GetName());
         return;
     }
-    
-    CollectedCoins.Add(CoinActor);
+
+    const FCoinId Id = Coin->GetCoinId();
+    if (Id.Index >= CollectedCoinBits.Num())
+    {
+        // Grows only up to the peak number of live coin actors
+        CollectedCoinBits.Add(false, Id.Index + 1 - CollectedCoinBits.Num());
+        CollectedCoinGenerations.SetNumZeroed(Id.Index + 1);
+    }
+
+    CollectedCoinBits[Id.Index] = true;
+    CollectedCoinGenerations[Id.Index] = Id.Generation;
     UE_LOG(LogSideRunnerScoring, Verbose, TEXT("Marked coin %s as collected"), *CoinActor->GetName());
 }
 
 void UCoinCounter::AddCoins(int32 Amount)
 {
-    // CRITICAL FIX: Thread-safe coin addition with better validation
     if (!bIsInitialized)
     {
         UE_LOG(LogSideRunnerScoring, Error, TEXT("CoinCounter not initialized, cannot add coins"));
@@ -147,35 +154,34 @@ void UCoinCounter::AddCoins(int32 Amount)
         return;
     }
 
-    // Thread-safe processing flag check
+    if (bProcessingCoin)
     {
-        FScopeLock Lock(&CoinMutex);
-        if (bProcessingCoin)
-        {
-            UE_LOG(LogSideRunnerScoring, Warning, TEXT("Prevented duplicate coin add! Amount: %d"), Amount);
-            return;
-        }
-        bProcessingCoin = true;
+        UE_LOG(LogSideRunnerScoring, Warning, TEXT("Prevented duplicate coin add! Amount: %d"), Amount);
+        return;
     }
+    bProcessingCoin = true;
 
-    // Store previous values and update coin count atomically with overflow protection
-    int32 PreviousCoinCount;
+    // PERFORMANCE: Lock-free saturating add (compare-exchange retries only if another writer raced us)
+    int32 PreviousCoinCount = FPlatformAtomics::AtomicRead(&CoinCount);
     int32 NewCoinCount;
+    for (;;)
     {
-        FScopeLock Lock(&CoinMutex);
-        PreviousCoinCount = CoinCount;
-        CoinCount = FMath::Clamp(CoinCount + Amount, 0, INT32_MAX);  // Prevent overflow
-        NewCoinCount = CoinCount;
+        NewCoinCount = static_cast<int32>(FMath::Min<int64>(static_cast<int64>(PreviousCoinCount) + Amount, MAX_int32));
+        const int32 ObservedCoinCount = FPlatformAtomics::InterlockedCompareExchange(&CoinCount, NewCoinCount, PreviousCoinCount);
+        if (ObservedCoinCount == PreviousCoinCount)
+        {
+            break;
+        }
+        PreviousCoinCount = ObservedCoinCount;
     }
 
-    // Debug log (outside critical section)
     UE_LOG(LogSideRunnerScoring, VeryVerbose, TEXT("Added %d coins. New total: %d"), Amount, NewCoinCount);
 
     // If we're using persistent coins, update and save them
     if (bPersistentCoins)
     {
         LevelPersistentCoins += Amount;
-        SavePersistentCoins();
+        SavePersistentCoins(Amount);
     }
 
     // OPTIMIZATION: Batch UI updates to prevent spam
@@ -196,13 +202,7 @@ void UCoinCounter::AddCoins(int32 Amount)
                 UCoinCounter* CoinCounter = WeakThis.Get();
                 if (CoinCounter)
                 {
-                    // Read current count safely for delayed broadcast
-                    int32 CurrentCount;
-                    {
-                        FScopeLock Lock(&CoinCounter->CoinMutex);
-                        CurrentCount = CoinCounter->CoinCount;
-                    }
-                    CoinCounter->OnCoinsUpdated.Broadcast(CurrentCount);
+                    CoinCounter->OnCoinsUpdated.Broadcast(CoinCounter->GetCurrentCoinCount());
                 }
             }, UpdateIntervalCopy, false);
         }
@@ -218,7 +218,7 @@ void UCoinCounter::AddCoins(int32 Amount)
         OnCoinsUpdated.Broadcast(NewCoinCount);
     }
 
-    // Check if we've collected all coins (using thread-safe method)
+    // Check if we've collected all coins
     bool bAllCoinsCollected = HasCollectedAllCoins();
     if (bAllCoinsCollected && PreviousCoinCount != NewCoinCount)  // Only trigger once
     {
@@ -232,26 +232,29 @@ void UCoinCounter::AddCoins(int32 Amount)
         {
             ReachedMilestones.Add(Milestone);
             OnCoinMilestoneReached.Broadcast(Milestone);
+
+            // Milestones are a safe point to flush banked coins
+            if (bPersistentCoins)
+            {
+                if (UProgressSaveSubsystem* SaveService = UGameInstance::GetSubsystem<UProgressSaveSubsystem>(GetWorld() ? GetWorld()->GetGameInstance() : nullptr))
+                {
+                    SaveService->RequestSave();
+                }
+            }
         }
     }
 
     // Clear processing flag
-    {
-        FScopeLock Lock(&CoinMutex);
-        bProcessingCoin = false;
-    }
+    bProcessingCoin = false;
 }
 
 void UCoinCounter::ResetCoins()
 {
-    // Thread-safe reset
-    {
-        FScopeLock Lock(&CoinMutex);
-        CoinCount = 0;
-        CollectedCoins.Empty();
-        ReachedMilestones.Empty();
-        bProcessingCoin = false;
-    }
+    FPlatformAtomics::AtomicStore(&CoinCount, 0);
+    CollectedCoinBits.Empty();
+    CollectedCoinGenerations.Empty();
+    ReachedMilestones.Empty();
+    bProcessingCoin = false;
 
     // Broadcast the event with the new coin count (using known value 0)
     OnCoinsUpdated.Broadcast(0);
@@ -261,14 +264,8 @@ void UCoinCounter::ResetCoins()
 
 bool UCoinCounter::HasCollectedAllCoins() const
 {
-    // Thread-safe read
-    int32 CurrentCoinCount;
-    int32 TotalCoins;
-    {
-        FScopeLock Lock(&CoinMutex);
-        CurrentCoinCount = CoinCount;
-        TotalCoins = TotalCoinsInLevel;
-    }
+    const int32 CurrentCoinCount = GetCurrentCoinCount();
+    const int32 TotalCoins = GetTotalCoinsInLevel();
 
     if (bAutoCountCoinsInLevel)
     {
@@ -280,14 +277,8 @@ bool UCoinCounter::HasCollectedAllCoins() const
 
 float UCoinCounter::GetCompletionPercentage() const
 {
-    // Thread-safe read
-    int32 CurrentCoinCount;
-    int32 TotalCoins;
-    {
-        FScopeLock Lock(&CoinMutex);
-        CurrentCoinCount = CoinCount;
-        TotalCoins = TotalCoinsInLevel;
-    }
+    const int32 CurrentCoinCount = GetCurrentCoinCount();
+    const int32 TotalCoins = GetTotalCoinsInLevel();
 
     float MaxValue = bAutoCountCoinsInLevel ? FMath::Max(1, TotalCoins) : FMath::Max(1, MaxCoins);
     return FMath::Clamp((float)CurrentCoinCount / MaxValue * 100.0f, 0.0f, 100.0f);
@@ -301,6 +292,12 @@ void UCoinCounter::CountCoinsInLevel()
         return;
     }
 
+    // Chunks report their coins as they are materialized and recycled; no scan needed
+    if (CoinRegistry.IsValid() && CoinRegistry->HasCoinRegistrations())
+    {
+        return;
+    }
+
     // PERFORMANCE: Use TActorIterator instead of GetAllActorsOfClass to avoid memory allocation
     int32 NewTotal = 0;
     for (TActorIterator<ACoinPickup> It(GetWorld()); It; ++It)
@@ -311,66 +308,69 @@ void UCoinCounter::CountCoinsInLevel()
         }
     }
 
-    // Thread-safe write
-    {
-        FScopeLock Lock(&CoinMutex);
-        TotalCoinsInLevel = NewTotal;
-    }
+    FPlatformAtomics::AtomicStore(&TotalCoinsInLevel, NewTotal);
 
     UE_LOG(LogSideRunnerScoring, Log, TEXT("Found %d coins in the level"), NewTotal);
 }
 
 int32 UCoinCounter::GetCurrentCoinCount() const
 {
-    FScopeLock Lock(&CoinMutex);
-    return CoinCount;
+    return FPlatformAtomics::AtomicRead(&CoinCount);
 }
 
 int32 UCoinCounter::GetTotalCoinsInLevel() const
 {
-    FScopeLock Lock(&CoinMutex);
-    return TotalCoinsInLevel;
+    // PERFORMANCE: O(1) running total maintained by chunk registration
+    if (const UCoinPoolSubsystem* Registry = CoinRegistry.Get())
+    {
+        if (Registry->HasCoinRegistrations())
+        {
+            return Registry->GetNumRegisteredCoins();
+        }
+    }
+
+    return FPlatformAtomics::AtomicRead(&TotalCoinsInLevel);
 }
 
-void UCoinCounter::SavePersistentCoins()
+void UCoinCounter::SavePersistentCoins(int32 Amount)
 {
-    // This is a simple implementation that should be expanded
-    // with your game's save system
-    UE_LOG(LogSideRunnerScoring, Log, TEXT("Saving %d persistent coins"), LevelPersistentCoins);
-
-    // Here you would save to your game's save system
-    // Example pseudocode (replace with your save game implementation):
-    /*
-    UMySaveGame* SaveGameInstance = Cast<UMySaveGame>(UGameplayStatics::CreateSaveGameObject(UMySaveGame::StaticClass()));
-    if (SaveGameInstance)
+    // PERFORMANCE: Only marks the save dirty; the save service writes in the background at the next safe point
+    if (UProgressSaveSubsystem* SaveService = UGameInstance::GetSubsystem<UProgressSaveSubsystem>(GetWorld() ? GetWorld()->GetGameInstance() : nullptr))
     {
-        SaveGameInstance->PersistentCoins = LevelPersistentCoins;
-        UGameplayStatics::SaveGameToSlot(SaveGameInstance, "CoinSave", 0);
+        SaveService->AddPersistentCoins(Amount);
     }
-    */
+
+    UE_LOG(LogSideRunnerScoring, VeryVerbose, TEXT("Banked %d persistent coins (level total %d)"), Amount, LevelPersistentCoins);
 }
 
 void UCoinCounter::LoadPersistentCoins()
 {
-    // This is a simple implementation that should be expanded
-    // with your game's save system
-    UE_LOG(LogSideRunnerScoring, Log, TEXT("Loading persistent coins"));
-
-    // Here you would load from your game's save system
-    // Example pseudocode (replace with your save game implementation):
-    /*
-    UMySaveGame* SaveGameInstance = Cast<UMySaveGame>(UGameplayStatics::LoadGameFromSlot("CoinSave", 0));
-    if (SaveGameInstance)
+    UProgressSaveSubsystem* SaveService = UGameInstance::GetSubsystem<UProgressSaveSubsystem>(GetWorld() ? GetWorld()->GetGameInstance() : nullptr);
+    if (!SaveService)
+    {
+        UE_LOG(LogSideRunnerScoring, Warning, TEXT("No save service - persistent coins not loaded"));
+        return;
+    }
+
+    // The save loads asynchronously; pick the value up when it arrives
+    if (SaveService->IsProgressLoaded())
+    {
+        HandleProgressLoaded(SaveService->GetProgress());
+    }
+    else
     {
-        LevelPersistentCoins = SaveGameInstance->PersistentCoins;
-        UE_LOG(LogSideRunnerScoring, Log, TEXT("Loaded %d persistent coins"), LevelPersistentCoins);
+        SaveService->OnProgressLoaded.AddUObject(this, &UCoinCounter::HandleProgressLoaded);
     }
-    */
+}
+
+void UCoinCounter::HandleProgressLoaded(const FSideRunnerProgress& Progress)
+{
+    LevelPersistentCoins = Progress.PersistentCoins;
+    UE_LOG(LogSideRunnerScoring, Log, TEXT("Loaded %d persistent coins"), LevelPersistentCoins);
 }
 
 TArray<int32> UCoinCounter::GetReachedMilestones() const
 {
-    FScopeLock Lock(&CoinMutex);
     return ReachedMilestones;
 }
 
@@ -2,7 +2,6 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
-#include "HAL/CriticalSection.h"
 #include "CoinCounter.generated.h"
 
 // Delegate declarations for coin events
@@ -26,7 +25,7 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Coins")
     void AddCoins(int32 Amount);
     
-    // Get current coin count (thread-safe)
+    // Get current coin count (lock-free)
     UFUNCTION(BlueprintPure, Category = "Coins")
     int32 GetCurrentCoinCount() const;
     
@@ -67,7 +66,7 @@ protected:
     virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 #endif
 
-    // Current coin count
+    // Current coin count (written only through FPlatformAtomics)
     UPROPERTY(BlueprintReadOnly, Category = "Coins")
     int32 CoinCount;
     
@@ -101,34 +100,39 @@ public:
     FOnCoinMilestoneReachedDelegate OnCoinMilestoneReached;
 
 private:
-    // Set of collected coin actors to prevent double collection
-    UPROPERTY()
-    TSet<AActor*> CollectedCoins;
+    // PERFORMANCE: Collected flags indexed by FCoinId::Index, tagged with the coin's generation.
+    // A pooled coin reused by a new chunk has a new generation, so its old flag no longer matches.
+    // Indices are recycled by UCoinPoolSubsystem, so memory is bounded by live coin actors, not run length.
+    TBitArray<> CollectedCoinBits;
+    TArray<uint16> CollectedCoinGenerations;
     
     // Milestones that have been reached
     UPROPERTY()
     TArray<int32> ReachedMilestones;
     
-    // Flag to prevent multiple coin additions at once
+    // Re-entrancy guard: delegates fired from AddCoins must not add coins again
     bool bProcessingCoin;
     
-    // Total coins found in the level
+    // Total coins found in the level (written only through FPlatformAtomics)
     int32 TotalCoinsInLevel;
     
     // Persistent coins across level reloads
     int32 LevelPersistentCoins;
     
-    // NEW: Thread safety and optimization variables
-    mutable FCriticalSection CoinMutex;
+    // Optimization variables
     bool bIsInitialized;
     float LastUpdateTime;
     float UpdateInterval;
     
-    // Function to count coins in the level
+    // World coin registry; once chunks register coins, totals come from here instead of a level scan
+    TWeakObjectPtr<class UCoinPoolSubsystem> CoinRegistry;
+
+    // Function to count coins in the level (fallback for levels whose coins are not registered by chunks)
     UFUNCTION()
     void CountCoinsInLevel();
     
-    // Save/Load persistent coins (integrate with your save system)
-    void SavePersistentCoins();
+    // Save/Load persistent coins through UProgressSaveSubsystem (written asynchronously at safe points)
+    void SavePersistentCoins(int32 Amount);
     void LoadPersistentCoins();
+    void HandleProgressLoaded(const struct FSideRunnerProgress& Progress);
 };
\ No newline at end of file
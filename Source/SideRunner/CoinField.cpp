@@ -0,0 +1,239 @@
+#include "CoinField.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "CoinCounter.h"
+#include "StatusEffectComponent.h"
+#include "CollectionEffectsSubsystem.h"
+#include "SideRunnerGameInstance.h"
+#include "SideRunner.h" // Custom log categories
+
+ACoinField::ACoinField()
+{
+    PrimaryActorTick.bCanEverTick = true;
+    PrimaryActorTick.bStartWithTickEnabled = false;
+
+    // One draw for every coin; overlap is tested in code, so no collision
+    CoinInstances = CreateDefaultSubobject<UInstancedStaticMeshComponent>(TEXT("CoinInstances"));
+    RootComponent = CoinInstances;
+    CoinInstances->SetMobility(EComponentMobility::Movable);
+    CoinInstances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    CoinInstances->SetGenerateOverlapEvents(false);
+    CoinInstances->SetCastShadow(false);
+
+    CollectRadius = 75.0f;
+    MagnetCollectRadius = 400.0f;
+    NumLiveCoins = 0;
+    InstanceScale = FVector::OneVector;
+    CollectEffect = nullptr;
+    CollectSound = nullptr;
+}
+
+void ACoinField::Configure(UStaticMesh* Mesh, const FVector& Scale, UParticleSystem* Effect, USoundBase* Sound)
+{
+    if (Mesh && CoinInstances->GetStaticMesh() != Mesh)
+    {
+        CoinInstances->SetStaticMesh(Mesh);
+    }
+    InstanceScale = Scale;
+    CollectEffect = Effect;
+    CollectSound = Sound;
+}
+
+// ======================================================================
+// Coin Table
+// ======================================================================
+
+int32 ACoinField::AddCoinBlock(TArrayView<const FVector> Locations, int32 Value)
+{
+    if (Locations.Num() == 0)
+    {
+        return INDEX_NONE;
+    }
+
+    FCoinBlock Block;
+    Block.MinY = TNumericLimits<float>::Max();
+    Block.MaxY = TNumericLimits<float>::Lowest();
+    Block.Slots.Reserve(Locations.Num());
+
+    for (const FVector& Location : Locations)
+    {
+        int32 Slot;
+        if (FreeSlots.Num() > 0)
+        {
+            // Reuse a row and its instance
+            Slot = FreeSlots.Pop();
+            Positions[Slot] = Location;
+            Values[Slot] = Value;
+            States[Slot] = ECoinState::Live;
+            SetInstanceVisible(Slot, true);
+        }
+        else
+        {
+            Slot = Positions.Add(Location);
+            Values.Add(Value);
+            States.Add(ECoinState::Live);
+            CoinInstances->AddInstance(FTransform(FRotator::ZeroRotator, Location, InstanceScale), true);
+        }
+
+        Block.Slots.Add(Slot);
+        Block.MinY = FMath::Min(Block.MinY, Location.Y);
+        Block.MaxY = FMath::Max(Block.MaxY, Location.Y);
+    }
+
+    NumLiveCoins += Locations.Num();
+    CoinInstances->MarkRenderStateDirty();
+    SetActorTickEnabled(true);
+
+    return Blocks.Add(MoveTemp(Block));
+}
+
+int32 ACoinField::RemoveCoinBlock(int32 BlockHandle)
+{
+    if (!Blocks.IsValidIndex(BlockHandle))
+    {
+        return 0;
+    }
+
+    const int32 NumCoins = Blocks[BlockHandle].Slots.Num();
+
+    for (const int32 Slot : Blocks[BlockHandle].Slots)
+    {
+        if (States[Slot] == ECoinState::Live)
+        {
+            SetInstanceVisible(Slot, false);
+            NumLiveCoins--;
+        }
+        States[Slot] = ECoinState::Free;
+        FreeSlots.Add(Slot);
+    }
+
+    Blocks.RemoveAt(BlockHandle);
+    CoinInstances->MarkRenderStateDirty();
+
+    if (Blocks.Num() == 0)
+    {
+        SetActorTickEnabled(false);
+    }
+
+    return NumCoins;
+}
+
+void ACoinField::ClearCoins()
+{
+    Positions.Empty();
+    Values.Empty();
+    States.Empty();
+    FreeSlots.Empty();
+    Blocks.Empty();
+    NumLiveCoins = 0;
+
+    CoinInstances->ClearInstances();
+    SetActorTickEnabled(false);
+}
+
+void ACoinField::SetInstanceVisible(int32 Slot, bool bVisible)
+{
+    // Hidden = zero scale, so instance indices stay stable
+    const FTransform Transform(FRotator::ZeroRotator, Positions[Slot], bVisible ? InstanceScale : FVector::ZeroVector);
+    CoinInstances->UpdateInstanceTransform(Slot, Transform, true, false, true);
+}
+
+// ======================================================================
+// Collection
+// ======================================================================
+
+void ACoinField::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    if (!CachedRunner.IsValid())
+    {
+        const APlayerController* PC = GetWorld()->GetFirstPlayerController();
+        CachedRunner = PC ? PC->GetPawn() : nullptr;
+        CachedRunnerEffects = CachedRunner.IsValid() ? CachedRunner->FindComponentByClass<UStatusEffectComponent>() : nullptr;
+    }
+
+    APawn* Runner = CachedRunner.Get();
+    if (!Runner || NumLiveCoins == 0)
+    {
+        return;
+    }
+
+    const FVector RunnerLocation = Runner->GetActorLocation();
+    const UStatusEffectComponent* RunnerEffects = CachedRunnerEffects.Get();
+    const float Radius = RunnerEffects && RunnerEffects->HasEffect(StatusEffectNames::Magnet) ? MagnetCollectRadius : CollectRadius;
+    const float RadiusSquared = Radius * Radius;
+
+    TArray<int32, TInlineAllocator<16>> Collected;
+    int32 CollectedValue = 0;
+
+    // PERFORMANCE: Only blocks whose Y span reaches the runner are tested (usually one or two)
+    for (FCoinBlock& Block : Blocks)
+    {
+        if (RunnerLocation.Y + Radius < Block.MinY || RunnerLocation.Y - Radius > Block.MaxY)
+        {
+            continue;
+        }
+
+        for (const int32 Slot : Block.Slots)
+        {
+            if (States[Slot] == ECoinState::Live && FVector::DistSquared(RunnerLocation, Positions[Slot]) <= RadiusSquared)
+            {
+                States[Slot] = ECoinState::Collected;
+                SetInstanceVisible(Slot, false);
+                Collected.Add(Slot);
+                CollectedValue += Values[Slot];
+            }
+        }
+    }
+
+    if (Collected.Num() > 0)
+    {
+        NumLiveCoins -= Collected.Num();
+        CoinInstances->MarkRenderStateDirty();
+        HandleCollected(Runner, Collected, CollectedValue);
+    }
+}
+
+void ACoinField::HandleCollected(APawn* Runner, TArrayView<const int32> Slots, int32 TotalValue)
+{
+    // Same crediting path as ACoinPickup: counter on the pawn, then on its controller
+    UCoinCounter* CoinCounterComp = Runner->FindComponentByClass<UCoinCounter>();
+    if (!CoinCounterComp)
+    {
+        if (AController* Controller = Runner->GetController())
+        {
+            CoinCounterComp = Controller->FindComponentByClass<UCoinCounter>();
+        }
+    }
+
+    if (CoinCounterComp)
+    {
+        CoinCounterComp->AddCoins(TotalValue);
+    }
+
+    if (USideRunnerGameInstance* GameInstance = Cast<USideRunnerGameInstance>(GetWorld()->GetGameInstance()))
+    {
+        for (int32 i = 0; i < Slots.Num(); ++i)
+        {
+            GameInstance->AddCoinBonus();
+        }
+    }
+
+    if (UCollectionEffectsSubsystem* Effects = GetWorld()->GetSubsystem<UCollectionEffectsSubsystem>())
+    {
+        for (const int32 Slot : Slots)
+        {
+            Effects->PlayCollectEffect(CollectEffect, CollectSound, Positions[Slot]);
+        }
+    }
+
+    OnCoinsCollected.Broadcast(Slots.Num(), TotalValue);
+
+#if UE_BUILD_DEVELOPMENT
+    UE_LOG(LogSideRunnerScoring, VeryVerbose, TEXT("CoinField: Collected %d proxy coins (value %d)"), Slots.Num(), TotalValue);
+#endif
+}
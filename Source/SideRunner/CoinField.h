@@ -0,0 +1,126 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Containers/SparseArray.h"
+#include "CoinField.generated.h"
+
+class UInstancedStaticMeshComponent;
+class UStaticMesh;
+class UParticleSystem;
+class USoundBase;
+class UStatusEffectComponent;
+
+/**
+ * Proxy coins: every coin is a row in a coin table (position, value, state) drawn as one instance
+ * of a single instanced mesh, and collected by a per-frame radius check around the runner.
+ * Coins are added and removed in blocks, one block per procedural chunk.
+ *
+ * PERFORMANCE: A coin costs a few table bytes plus one mesh instance instead of an actor with four
+ * components. Freed rows (and their instances) are recycled, so the instance count never shrinks
+ * and instance indices never shift. Collection only tests blocks whose Y span is near the runner.
+ */
+UCLASS()
+class SIDERUNNER_API ACoinField : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    ACoinField();
+
+    virtual void Tick(float DeltaTime) override;
+
+    /**
+     * Sets the look and feel of the proxies, usually copied from an ACoinPickup class default.
+     *
+     * @param Mesh - Coin mesh drawn per instance
+     * @param Scale - Instance scale
+     * @param Effect - Particle system played on collection (may be null)
+     * @param Sound - Sound played on collection (may be null)
+     */
+    void Configure(UStaticMesh* Mesh, const FVector& Scale, UParticleSystem* Effect, USoundBase* Sound);
+
+    /**
+     * Adds a block of coins.
+     *
+     * @param Locations - World locations of the coins
+     * @param Value - Coin value of each coin
+     * @return Block handle for RemoveCoinBlock, or INDEX_NONE if Locations is empty
+     */
+    int32 AddCoinBlock(TArrayView<const FVector> Locations, int32 Value);
+
+    /**
+     * Removes a block added by AddCoinBlock (collected or not). Invalid handles are ignored.
+     *
+     * @param BlockHandle - Handle returned by AddCoinBlock
+     * @return Number of coins the block held
+     */
+    int32 RemoveCoinBlock(int32 BlockHandle);
+
+    /** Removes every coin. */
+    UFUNCTION(BlueprintCallable, Category = "Coin Field")
+    void ClearCoins();
+
+    /** Returns the number of uncollected coins. */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Coin Field")
+    int32 GetNumLiveCoins() const { return NumLiveCoins; }
+
+    /** Distance from the runner's origin at which a coin is collected. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Coin Field", meta = (ClampMin = "10.0", ClampMax = "1000.0"))
+    float CollectRadius;
+
+    /** Collect radius while the runner has the Magnet status effect (proxy coins are collected, not pulled). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Coin Field", meta = (ClampMin = "10.0", ClampMax = "2000.0"))
+    float MagnetCollectRadius;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+    UInstancedStaticMeshComponent* CoinInstances;
+
+    DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnProxyCoinsCollectedSignature, int32, NumCoins, int32, TotalValue);
+    UPROPERTY(BlueprintAssignable, Category = "Events")
+    FOnProxyCoinsCollectedSignature OnCoinsCollected;
+
+private:
+    enum class ECoinState : uint8
+    {
+        Free,
+        Live,
+        Collected
+    };
+
+    struct FCoinBlock
+    {
+        float MinY = 0.0f;
+        float MaxY = 0.0f;
+        TArray<int32> Slots;
+    };
+
+    /** Shows or hides the instance for a table row (render state is flushed by the caller). */
+    void SetInstanceVisible(int32 Slot, bool bVisible);
+
+    /** Credits collected coins to the runner and plays their effects. */
+    void HandleCollected(APawn* Runner, TArrayView<const int32> Slots, int32 TotalValue);
+
+    // Coin table (index-aligned; index == instance index)
+    TArray<FVector> Positions;
+    TArray<int32> Values;
+    TArray<ECoinState> States;
+    TArray<int32> FreeSlots;
+
+    TSparseArray<FCoinBlock> Blocks;
+
+    int32 NumLiveCoins;
+
+    FVector InstanceScale;
+
+    UPROPERTY()
+    UParticleSystem* CollectEffect;
+
+    UPROPERTY()
+    USoundBase* CollectSound;
+
+    TWeakObjectPtr<APawn> CachedRunner;
+
+    /** The runner's status effects, cached with CachedRunner (may be null) */
+    TWeakObjectPtr<UStatusEffectComponent> CachedRunnerEffects;
+};
@@ -1,10 +1,11 @@
 #include "CoinPickup.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/SphereComponent.h"
-#include "Particles/ParticleSystemComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "GameFramework/Character.h"
 #include "CoinCounter.h"
+#include "CoinPoolSubsystem.h"
+#include "CollectionEffectsSubsystem.h"
 #include "Engine/Engine.h"
 #include "SideRunnerGameInstance.h"
 #include "SideRunner.h" // Custom log categories
@@ -13,9 +14,6 @@
 #include "DrawDebugHelpers.h"
 #endif
 
-// PERFORMANCE: Static pooling system with thread safety considerations
-TMap<UWorld*, FActorPool<ACoinPickup>> ACoinPickup::CoinPools;
-
 ACoinPickup::ACoinPickup()
 {
     PrimaryActorTick.bCanEverTick = true;
@@ -33,11 +31,6 @@ ACoinPickup::ACoinPickup()
     CollisionSphere->SetCollisionProfileName(TEXT("OverlapOnlyPawn"));
     CollisionSphere->SetGenerateOverlapEvents(true);
 
-    // Particle system for collection effects
-    CollectParticles = CreateDefaultSubobject<UParticleSystemComponent>(TEXT("CollectParticles"));
-    CollectParticles->SetupAttachment(RootComponent);
-    CollectParticles->bAutoActivate = false;
-
     // Magnet component for coin attraction
     CoinMagnet = CreateDefaultSubobject<USphereComponent>(TEXT("CoinMagnet"));
     CoinMagnet->SetupAttachment(RootComponent);
@@ -51,6 +44,8 @@ ACoinPickup::ACoinPickup()
     HoverAmplitude = 10.0f;
     HoverFrequency = 2.0f;
     CoinValue = 1;
+    CollectEffect = nullptr;
+    CollectSound = nullptr;
     bIsCollected = false;
     bCollected = false;
     CurrentTime = 0.0f;
@@ -84,6 +79,11 @@ void ACoinPickup::BeginPlay()
     // Store initial location for hover effects
     InitialLocation = GetActorLocation();
 
+    if (UCoinPoolSubsystem* CoinPool = GetWorld()->GetSubsystem<UCoinPoolSubsystem>())
+    {
+        CoinId = CoinPool->AllocateCoinId();
+    }
+
     // PERFORMANCE: Bind events only when needed
     if (CollisionSphere)
     {
@@ -224,11 +224,19 @@ void ACoinPickup::OnMagnetOverlap(UPrimitiveComponent* OverlappedComponent, AAct
 
     if (ACharacter* Character = Cast<ACharacter>(OtherActor))
     {
-        bMagnetActivated = true;
-        TargetActor = OtherActor;
+        AttractTo(OtherActor);
     }
 }
 
+void ACoinPickup::AttractTo(AActor* Target)
+{
+    if (!Target || bIsCollected || bCollected || bMagnetActivated)
+        return;
+
+    bMagnetActivated = true;
+    TargetActor = Target;
+}
+
 void ACoinPickup::Collect_Implementation(ACharacter* Character)
 {
     // PERFORMANCE: Atomic collection check to prevent double collection
@@ -276,13 +284,12 @@ void ACoinPickup::HandleCollectionEffects()
         CoinMagnet->SetCollisionEnabled(ECollisionEnabled::NoCollision);
     }
 
-    // Play effects
-    if (CollectParticles && CollectParticles->Template)
+    // Play effects from the shared pool (no per-coin components)
+    if (UCollectionEffectsSubsystem* Effects = GetWorld()->GetSubsystem<UCollectionEffectsSubsystem>())
     {
-        CollectParticles->ActivateSystem();
+        Effects->PlayCollectEffect(CollectEffect, CollectSound, GetActorLocation());
     }
-
-    if (CollectSound)
+    else if (CollectSound)
     {
         UGameplayStatics::PlaySoundAtLocation(this, CollectSound, GetActorLocation());
     }
@@ -321,6 +328,12 @@ void ACoinPickup::UpdateCoinCounter(ACharacter* Character)
 
 void ACoinPickup::HandlePostCollection()
 {
+    if (bOwnerReleases)
+    {
+        // Stays hidden until the owner (e.g. its chunk) releases it to the pool
+        return;
+    }
+
     if (bCanRespawn)
     {
         // Schedule respawn
@@ -329,12 +342,9 @@ void ACoinPickup::HandlePostCollection()
     }
     else if (UseActorPooling)
     {
-        // Return to pool after brief delay for effects to finish
+        // Return to pool after brief delay for effects to finish (object-bound so a release clears it)
         FTimerHandle PoolTimer;
-        GetWorldTimerManager().SetTimer(PoolTimer, [this]()
-        {
-            ReturnToPool();
-        }, 1.0f, false);
+        GetWorldTimerManager().SetTimer(PoolTimer, this, &ACoinPickup::ReturnToPool, 1.0f, false);
     }
     else
     {
@@ -374,34 +384,14 @@ ACoinPickup* ACoinPickup::SpawnFromPool(UWorld* World, TSubclassOf<ACoinPickup>
         return World->SpawnActor<ACoinPickup>(CoinClass, Transform);
     }
 
-    // Get or create the pool for this world
-    FActorPool<ACoinPickup>& Pool = CoinPools.FindOrAdd(World);
-    
-    // Try to get an actor from the pool first
-    if (ACoinPickup* Coin = Pool.GetActor(Tag))
-    {
-        // Reset and reuse the existing coin
-        Coin->SetActorTransform(Transform);
-        Coin->InitialLocation = Transform.GetLocation();
-        Coin->PoolTag = Tag;
-        Coin->ResetCoinState();
-        Coin->SetActorHiddenInGame(false);
-        Coin->SetActorEnableCollision(true);
-        Coin->SetActorTickEnabled(true);
-        
-        return Coin;
-    }
-    
-    // If no pooled actor available, spawn a new one
-    ACoinPickup* NewCoin = World->SpawnActor<ACoinPickup>(CoinClass, Transform);
-    if (NewCoin)
+    // One pool per world, owned by the world
+    UCoinPoolSubsystem* CoinPool = World->GetSubsystem<UCoinPoolSubsystem>();
+    if (!CoinPool)
     {
-        NewCoin->PoolTag = Tag;
-        NewCoin->InitialLocation = Transform.GetLocation();
-        NewCoin->ResetCoinState();
+        return World->SpawnActor<ACoinPickup>(CoinClass, Transform);
     }
-    
-    return NewCoin;
+
+    return CoinPool->AcquireCoin(CoinClass, Transform, Tag);
 }
 
 void ACoinPickup::ReturnToPool()
@@ -412,20 +402,11 @@ void ACoinPickup::ReturnToPool()
         return;
     }
 
-    // Get the pool for this world
-    FActorPool<ACoinPickup>* Pool = CoinPools.Find(GetWorld());
-    if (Pool)
+    // Only coins handed out by the world's pool can go back to it
+    UCoinPoolSubsystem* CoinPool = GetWorld() ? GetWorld()->GetSubsystem<UCoinPoolSubsystem>() : nullptr;
+    if (CoinPool && bCheckedOutFromPool)
     {
-        // Hide and disable the actor
-        SetActorHiddenInGame(true);
-        SetActorEnableCollision(false);
-        SetActorTickEnabled(false);
-
-        // Reset state for reuse
-        ResetCoinState();
-
-        // Return to pool - this is the critical step that was missing
-        Pool->ReturnActor(this, PoolTag);
+        CoinPool->ReleaseCoin(this);
     }
     else
     {
@@ -436,22 +417,27 @@ void ACoinPickup::ReturnToPool()
 
 void ACoinPickup::ClearPool(UWorld* World)
 {
-    if (World)
+    if (UCoinPoolSubsystem* CoinPool = World ? World->GetSubsystem<UCoinPoolSubsystem>() : nullptr)
     {
-        CoinPools.Remove(World);
+        CoinPool->ClearPool();
     }
 }
 
 void ACoinPickup::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    Super::EndPlay(EndPlayReason);
-
-    // Clean up pools on level transition
-    if (EndPlayReason == EEndPlayReason::LevelTransition ||
-        EndPlayReason == EEndPlayReason::EndPlayInEditor)
+    // Keep the pool's occupancy honest if a checked-out coin is destroyed instead of released
+    // (pool lifetime itself is tied to the world, so nothing to clear on level transition)
+    if (UCoinPoolSubsystem* CoinPool = GetWorld() ? GetWorld()->GetSubsystem<UCoinPoolSubsystem>() : nullptr)
     {
-        ClearPool(GetWorld());
+        if (bCheckedOutFromPool)
+        {
+            CoinPool->NotifyCoinDestroyed(this);
+        }
+        CoinPool->FreeCoinId(CoinId);
+        CoinId = FCoinId();
     }
+
+    Super::EndPlay(EndPlayReason);
 }
 
 #if WITH_EDITOR || UE_BUILD_DEVELOPMENT
@@ -2,9 +2,20 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
-#include "ActorPool.h"
 #include "CoinPickup.generated.h"
 
+/**
+ * Compact coin identity issued by UCoinPoolSubsystem: a dense index recycled across coin actors,
+ * plus a generation that advances whenever the index or the pooled coin is reused.
+ */
+struct FCoinId
+{
+    int32 Index = INDEX_NONE;
+    uint16 Generation = 0;
+
+    bool IsValid() const { return Index != INDEX_NONE; }
+};
+
 /**
  * Performance-optimized coin pickup with magnetism, animation, and pooling support.
  * Features distance-based tick optimization and efficient collection handling.
@@ -31,13 +42,13 @@ public:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
     class USphereComponent* CollisionSphere;
     
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
-    class UParticleSystemComponent* CollectParticles;
-    
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
     class USphereComponent* CoinMagnet;
     
-    // PERFORMANCE: Audio and Value
+    // PERFORMANCE: Effects and Value (played through the world's pooled UCollectionEffectsSubsystem)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Coin")
+    class UParticleSystem* CollectEffect;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Coin")
     class USoundBase* CollectSound;
     
@@ -69,10 +80,12 @@ public:
     float TickDistance;
     
     // PERFORMANCE: Magnetism System
+    // Coins are normally pulled by the runner's Magnet status effect (see AttractTo).
+    // bEnableMagnetism keeps the legacy always-on per-coin sphere for special coins.
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Magnetism")
     bool bEnableMagnetism;
     
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Magnetism", meta = (EditCondition = "bEnableMagnetism", ClampMin = "100.0", ClampMax = "1000.0"))
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Magnetism", meta = (ClampMin = "100.0", ClampMax = "1000.0"))
     float MagnetismSpeed;
     
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Magnetism")
@@ -119,7 +132,7 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Pooling")
     void ReturnToPool();
     
-    // PERFORMANCE: Static pooling functions
+    // PERFORMANCE: Pooling entry points (backed by the world's UCoinPoolSubsystem)
     UFUNCTION(BlueprintCallable, Category = "Pooling", meta = (WorldContext = "World"))
     static ACoinPickup* SpawnFromPool(UWorld* World, TSubclassOf<ACoinPickup> CoinClass, 
                                    const FTransform& Transform, FName Tag = NAME_None);
@@ -127,6 +140,18 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Pooling", meta = (WorldContext = "World"))
     static void ClearPool(UWorld* World);
 
+    /**
+     * Starts pulling the coin toward an actor (used by the runner's magnet effect).
+     * Ignored once the coin is collected or already attracted.
+     *
+     * @param Target - Actor the coin flies to
+     */
+    UFUNCTION(BlueprintCallable, Category = "Magnetism")
+    void AttractTo(AActor* Target);
+
+    /** Returns this coin's current identity (invalid outside game worlds). */
+    FCoinId GetCoinId() const { return CoinId; }
+
 protected:
     // Collision event handlers
     UFUNCTION()
@@ -140,12 +165,20 @@ protected:
                          bool bFromSweep, const FHitResult& SweepResult);
 
 private:
+    friend class UCoinPoolSubsystem;
+
+    // Identity for per-coin bookkeeping (e.g. UCoinCounter), renewed each time the pool hands the coin out
+    FCoinId CoinId;
+
     // PERFORMANCE: Internal state management
     FVector InitialLocation;
     float CurrentTime;
-    
-    // Static pool management
-    static TMap<UWorld*, FActorPool<ACoinPickup>> CoinPools;
+
+    // Pool state, owned by UCoinPoolSubsystem
+    bool bCheckedOutFromPool = false;
+
+    // True if whoever acquired the coin (e.g. a procedural chunk) also releases it
+    bool bOwnerReleases = false;
 
     // PERFORMANCE: Helper functions for cleaner code
     bool ShouldTickBasedOnDistance() const;
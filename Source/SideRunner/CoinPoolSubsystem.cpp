@@ -0,0 +1,263 @@
+#include "CoinPoolSubsystem.h"
+#include "CoinPickup.h"
+#include "BaseLevel.h"
+#include "Engine/World.h"
+#include "SideRunner.h" // Custom log categories
+
+void UCoinPoolSubsystem::Deinitialize()
+{
+#if UE_BUILD_DEVELOPMENT
+    UE_LOG(LogSideRunnerScoring, Log, TEXT("CoinPoolSubsystem: Spawned=%d Reused=%d Peak=%d Free=%d"),
+           NumSpawned, NumReused, PeakCheckedOut, FreeCoinRefs.Num());
+#endif
+
+    // The world is tearing down and destroys the coins itself
+    Pool.Clear();
+    FreeCoinRefs.Empty();
+    NumCheckedOut = 0;
+
+    Super::Deinitialize();
+}
+
+bool UCoinPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+FName UCoinPoolSubsystem::GetPoolKey(TSubclassOf<ACoinPickup> CoinClass, FName Tag)
+{
+    // Class name by default, so different coin classes never share a sub-pool
+    return Tag.IsNone() && CoinClass ? CoinClass->GetFName() : Tag;
+}
+
+// ======================================================================
+// Acquire / Release
+// ======================================================================
+
+ACoinPickup* UCoinPoolSubsystem::AcquireCoin(TSubclassOf<ACoinPickup> CoinClass, const FTransform& Transform, FName Tag,
+    EChunkDormancyMode WakeMode, bool bOwnerReleases)
+{
+    UWorld* World = GetWorld();
+    if (!World || !CoinClass)
+    {
+        return nullptr;
+    }
+
+    const FName PoolKey = GetPoolKey(CoinClass, Tag);
+
+    // Skip coins destroyed while sleeping (e.g. by a level script)
+    ACoinPickup* Coin = Pool.GetActor(PoolKey);
+    while (Coin && !IsValid(Coin))
+    {
+        FreeCoinRefs.RemoveSwap(Coin);
+        Coin = Pool.GetActor(PoolKey);
+    }
+
+    if (Coin)
+    {
+        FreeCoinRefs.RemoveSwap(Coin);
+
+        // Move before waking: a bulk-dormant coin has no physics body yet
+        Coin->SetActorTransform(Transform);
+        ABaseLevel::SetActorsDormant(MakeArrayView(&Coin, 1), false, WakeMode);
+        RenewCoinId(Coin);
+        NumReused++;
+    }
+    else
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+        Coin = World->SpawnActor<ACoinPickup>(CoinClass, Transform, SpawnParams);
+        if (!Coin)
+        {
+            UE_LOG(LogSideRunnerScoring, Warning, TEXT("CoinPoolSubsystem: Failed to spawn %s"), *CoinClass->GetName());
+            return nullptr;
+        }
+        NumSpawned++;
+    }
+
+    Coin->PoolTag = PoolKey;
+    Coin->InitialLocation = Transform.GetLocation();
+    Coin->bCheckedOutFromPool = true;
+    Coin->bOwnerReleases = bOwnerReleases;
+    Coin->ResetCoinState();
+
+    NumCheckedOut++;
+    PeakCheckedOut = FMath::Max(PeakCheckedOut, NumCheckedOut);
+    return Coin;
+}
+
+void UCoinPoolSubsystem::ReleaseCoins(TArrayView<ACoinPickup* const> Coins, EChunkDormancyMode SleepMode)
+{
+    TArray<AActor*, TInlineAllocator<32>> Sleeping;
+
+    for (ACoinPickup* Coin : Coins)
+    {
+        if (!IsValid(Coin) || !Coin->bCheckedOutFromPool)
+        {
+            continue; // Not ours, or already released
+        }
+
+        Coin->GetWorldTimerManager().ClearAllTimersForObject(Coin);
+        Coin->ResetCoinState();
+        Coin->bCheckedOutFromPool = false;
+        Coin->bOwnerReleases = false;
+
+        Pool.ReturnActor(Coin, Coin->PoolTag);
+        FreeCoinRefs.Add(Coin);
+        Sleeping.Add(Coin);
+        NumCheckedOut--;
+    }
+
+    // PERFORMANCE: Put the whole batch to sleep in one pass
+    ABaseLevel::SetActorsDormant(Sleeping, true, SleepMode);
+}
+
+void UCoinPoolSubsystem::ReleaseCoin(ACoinPickup* Coin, EChunkDormancyMode SleepMode)
+{
+    ReleaseCoins(MakeArrayView(&Coin, 1), SleepMode);
+}
+
+int32 UCoinPoolSubsystem::PrewarmCoins(TSubclassOf<ACoinPickup> CoinClass, int32 Count, FName Tag, EChunkDormancyMode SleepMode)
+{
+    UWorld* World = GetWorld();
+    if (!World || !CoinClass || Count <= 0)
+    {
+        return 0;
+    }
+
+    const FName PoolKey = GetPoolKey(CoinClass, Tag);
+
+    int32 NumFreeForKey = 0;
+    for (const ACoinPickup* Coin : FreeCoinRefs)
+    {
+        NumFreeForKey += (IsValid(Coin) && Coin->PoolTag == PoolKey) ? 1 : 0;
+    }
+
+    // Spawn far below the course so nothing overlaps before the coins go to sleep
+    const FTransform ParkingTransform(FVector(0.0f, 0.0f, -100000.0f));
+
+    TArray<ACoinPickup*, TInlineAllocator<32>> NewCoins;
+    for (int32 i = NumFreeForKey; i < Count; ++i)
+    {
+        if (ACoinPickup* Coin = AcquireCoin(CoinClass, ParkingTransform, PoolKey))
+        {
+            NewCoins.Add(Coin);
+        }
+    }
+    ReleaseCoins(NewCoins, SleepMode);
+
+#if UE_BUILD_DEVELOPMENT
+    UE_LOG(LogSideRunnerScoring, Log, TEXT("CoinPoolSubsystem: Pre-warmed %d %s coins"), NewCoins.Num(), *PoolKey.ToString());
+#endif
+
+    return NewCoins.Num();
+}
+
+void UCoinPoolSubsystem::ClearPool()
+{
+    for (ACoinPickup* Coin : FreeCoinRefs)
+    {
+        if (IsValid(Coin))
+        {
+            Coin->Destroy();
+        }
+    }
+
+    Pool.Clear();
+    FreeCoinRefs.Empty();
+}
+
+FCoinPoolStats UCoinPoolSubsystem::GetStats() const
+{
+    FCoinPoolStats Stats;
+    Stats.NumFree = FreeCoinRefs.Num();
+    Stats.NumCheckedOut = NumCheckedOut;
+    Stats.PeakCheckedOut = PeakCheckedOut;
+    Stats.NumSpawned = NumSpawned;
+    Stats.NumReused = NumReused;
+    return Stats;
+}
+
+void UCoinPoolSubsystem::NotifyCoinDestroyed(ACoinPickup* Coin)
+{
+    if (Coin && Coin->bCheckedOutFromPool)
+    {
+        Coin->bCheckedOutFromPool = false;
+        NumCheckedOut--;
+    }
+}
+
+// ======================================================================
+// Coin IDs
+// ======================================================================
+
+FCoinId UCoinPoolSubsystem::AllocateCoinId()
+{
+    FCoinId Id;
+    if (FreeCoinIds.Num() > 0)
+    {
+        Id.Index = FreeCoinIds.Pop();
+        Id.Generation = ++CoinIdGenerations[Id.Index];
+    }
+    else
+    {
+        Id.Index = CoinIdGenerations.Add(0);
+    }
+    return Id;
+}
+
+void UCoinPoolSubsystem::FreeCoinId(FCoinId Id)
+{
+    if (CoinIdGenerations.IsValidIndex(Id.Index) && CoinIdGenerations[Id.Index] == Id.Generation)
+    {
+        FreeCoinIds.Add(Id.Index);
+    }
+}
+
+void UCoinPoolSubsystem::RenewCoinId(ACoinPickup* Coin)
+{
+    if (CoinIdGenerations.IsValidIndex(Coin->CoinId.Index))
+    {
+        Coin->CoinId.Generation = ++CoinIdGenerations[Coin->CoinId.Index];
+    }
+}
+
+// ======================================================================
+// Chunk Coin Registry
+// ======================================================================
+
+void UCoinPoolSubsystem::RegisterChunkCoins(int32 ChunkIndex, int32 NumCoins)
+{
+    bHasCoinRegistrations = true;
+    NumLiveRegisteredCoins += FMath::Max(0, NumCoins);
+
+    if (ChunkIndex != INDEX_NONE)
+    {
+        if (ChunkIndex >= RegisteredChunks.Num())
+        {
+            RegisteredChunks.Add(false, ChunkIndex + 1 - RegisteredChunks.Num());
+        }
+        if (RegisteredChunks[ChunkIndex])
+        {
+            return; // Replayed chunk: its coins were already offered this run
+        }
+        RegisteredChunks[ChunkIndex] = true;
+    }
+
+    NumRegisteredCoins += FMath::Max(0, NumCoins);
+}
+
+void UCoinPoolSubsystem::UnregisterChunkCoins(int32 NumCoins)
+{
+    NumLiveRegisteredCoins = FMath::Max(0, NumLiveRegisteredCoins - FMath::Max(0, NumCoins));
+}
+
+void UCoinPoolSubsystem::ResetChunkCoinRegistry()
+{
+    // bHasCoinRegistrations stays set: the registry remains the authority for the new run
+    NumRegisteredCoins = 0;
+    NumLiveRegisteredCoins = 0;
+    RegisteredChunks.Reset();
+}
@@ -0,0 +1,179 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ActorPool.h"
+#include "EndlessRunnerTypes.h"
+#include "CoinPoolSubsystem.generated.h"
+
+class ACoinPickup;
+struct FCoinId;
+
+/** Occupancy and reuse counters of the world's coin pool. */
+USTRUCT(BlueprintType)
+struct FCoinPoolStats
+{
+    GENERATED_BODY()
+
+    /** Coins sleeping in the pool, ready for reuse */
+    UPROPERTY(BlueprintReadOnly, Category = "Coin Pool")
+    int32 NumFree = 0;
+
+    /** Coins currently handed out */
+    UPROPERTY(BlueprintReadOnly, Category = "Coin Pool")
+    int32 NumCheckedOut = 0;
+
+    /** Highest NumCheckedOut seen this world */
+    UPROPERTY(BlueprintReadOnly, Category = "Coin Pool")
+    int32 PeakCheckedOut = 0;
+
+    /** Coins spawned because the pool was empty (including pre-warm) */
+    UPROPERTY(BlueprintReadOnly, Category = "Coin Pool")
+    int32 NumSpawned = 0;
+
+    /** Acquires served from the pool */
+    UPROPERTY(BlueprintReadOnly, Category = "Coin Pool")
+    int32 NumReused = 0;
+};
+
+/**
+ * The single coin pool of a game world, shared by procedural chunks and ACoinPickup::SpawnFromPool.
+ * Lives and dies with its world, so pooled coins never outlive it or leak across PIE sessions.
+ *
+ * PERFORMANCE: Coins are recycled instead of spawned/destroyed per chunk. Sub-pools are keyed by
+ * tag (the coin class name unless given), and sleeping coins are GC-rooted here.
+ */
+UCLASS()
+class SIDERUNNER_API UCoinPoolSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+    /**
+     * Takes a coin from the pool, or spawns one if the sub-pool is empty. The coin is awake,
+     * at Transform and in its uncollected state.
+     *
+     * @param CoinClass - Class to spawn on a miss
+     * @param Transform - Where the coin goes (also its hover origin)
+     * @param Tag - Sub-pool to draw from (NAME_None = the class name)
+     * @param WakeMode - How a pooled coin is woken; match the mode it was released with
+     * @param bOwnerReleases - If true the caller returns the coin (e.g. on chunk recycle) and the coin
+     *                         stays hidden after collection instead of returning or destroying itself
+     * @return Coin, or nullptr if spawning failed
+     */
+    ACoinPickup* AcquireCoin(TSubclassOf<ACoinPickup> CoinClass, const FTransform& Transform, FName Tag = NAME_None,
+                             EChunkDormancyMode WakeMode = EChunkDormancyMode::PerActor, bool bOwnerReleases = false);
+
+    /**
+     * Puts coins to sleep and returns them to their sub-pools in one pass.
+     * Coins that were not acquired from this pool are ignored.
+     *
+     * @param Coins - Coins to release
+     * @param SleepMode - How the coins are put to sleep
+     */
+    void ReleaseCoins(TArrayView<ACoinPickup* const> Coins, EChunkDormancyMode SleepMode = EChunkDormancyMode::PerActor);
+
+    /** Releases a single coin (see ReleaseCoins). */
+    void ReleaseCoin(ACoinPickup* Coin, EChunkDormancyMode SleepMode = EChunkDormancyMode::PerActor);
+
+    /**
+     * Spawns sleeping coins until the sub-pool holds at least Count, so the first chunks don't spawn mid-run.
+     *
+     * @param CoinClass - Class to spawn
+     * @param Count - Minimum free coins wanted in the sub-pool
+     * @param Tag - Sub-pool to fill (NAME_None = the class name)
+     * @param SleepMode - How the new coins are put to sleep
+     * @return Number of coins spawned
+     */
+    int32 PrewarmCoins(TSubclassOf<ACoinPickup> CoinClass, int32 Count, FName Tag = NAME_None,
+                       EChunkDormancyMode SleepMode = EChunkDormancyMode::PerActor);
+
+    /** Destroys every sleeping coin and empties the pool. Coins in use are left alone. */
+    UFUNCTION(BlueprintCallable, Category = "Coin Pool")
+    void ClearPool();
+
+    /** Returns pool occupancy and reuse counters. */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Coin Pool")
+    FCoinPoolStats GetStats() const;
+
+    /** Called by a checked-out coin that is destroyed instead of released. */
+    void NotifyCoinDestroyed(ACoinPickup* Coin);
+
+    /**
+     * Issues a coin identity. Indices are recycled, so they stay dense and bounded by the
+     * number of live coin actors; a recycled index starts a new generation.
+     */
+    FCoinId AllocateCoinId();
+
+    /** Returns a coin's index for reuse (called when the coin leaves play). */
+    void FreeCoinId(FCoinId Id);
+
+    /**
+     * Records the coins a chunk makes available as it is materialized (call even with zero coins).
+     * Once any chunk registers, UCoinCounter takes its totals from here instead of scanning the world.
+     * Idempotent per chunk: a replayed chunk (warm respawn) counts as live again but its coins are
+     * only added to the run total the first time.
+     *
+     * @param ChunkIndex - Chunk key within the run, procedural or handcrafted (INDEX_NONE = always a new chunk)
+     * @param NumCoins - Coins placed by the chunk (actor or proxy)
+     */
+    void RegisterChunkCoins(int32 ChunkIndex, int32 NumCoins);
+
+    /**
+     * Records a chunk's coins leaving play when the chunk is recycled.
+     * They stay in the registered total, which counts every coin offered so far.
+     *
+     * @param NumCoins - Coins the chunk placed
+     */
+    void UnregisterChunkCoins(int32 NumCoins);
+
+    /** Returns the number of coins offered by registered chunks so far. */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Coin Pool")
+    int32 GetNumRegisteredCoins() const { return NumRegisteredCoins; }
+
+    /** Returns the number of registered coins in chunks that are still materialized. */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Coin Pool")
+    int32 GetNumLiveRegisteredCoins() const { return NumLiveRegisteredCoins; }
+
+    /** True once any chunk has registered its coins. */
+    bool HasCoinRegistrations() const { return bHasCoinRegistrations; }
+
+    /** Starts a new run: forgets every chunk and zeroes the coin totals. */
+    void ResetChunkCoinRegistry();
+
+private:
+    /** Sub-pool key for a class/tag pair. */
+    static FName GetPoolKey(TSubclassOf<ACoinPickup> CoinClass, FName Tag);
+
+    /** Advances a reused coin's generation so state recorded against its previous use no longer matches. */
+    void RenewCoinId(ACoinPickup* Coin);
+
+    FActorPool<ACoinPickup> Pool;
+
+    // GC roots for sleeping coins (FActorPool holds raw pointers outside UPROPERTY)
+    UPROPERTY()
+    TArray<ACoinPickup*> FreeCoinRefs;
+
+    // Current generation per coin ID index, and indices free for reuse
+    TArray<uint16> CoinIdGenerations;
+    TArray<int32> FreeCoinIds;
+
+    int32 NumCheckedOut = 0;
+    int32 PeakCheckedOut = 0;
+    int32 NumSpawned = 0;
+    int32 NumReused = 0;
+
+    // Chunk coin registry
+    int32 NumRegisteredCoins = 0;
+    int32 NumLiveRegisteredCoins = 0;
+    bool bHasCoinRegistrations = false;
+
+    // One bit per chunk key already counted in NumRegisteredCoins this run
+    TBitArray<> RegisteredChunks;
+};
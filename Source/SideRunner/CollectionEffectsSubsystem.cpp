@@ -0,0 +1,133 @@
+#include "CollectionEffectsSubsystem.h"
+#include "Particles/ParticleSystem.h"
+#include "Particles/ParticleSystemComponent.h"
+#include "Components/AudioComponent.h"
+#include "Sound/SoundBase.h"
+#include "Engine/World.h"
+#include "SideRunner.h" // Custom log categories
+
+void UCollectionEffectsSubsystem::Deinitialize()
+{
+    for (UParticleSystemComponent* Slot : ParticleSlots)
+    {
+        if (IsValid(Slot))
+        {
+            Slot->DestroyComponent();
+        }
+    }
+    for (UAudioComponent* Slot : AudioSlots)
+    {
+        if (IsValid(Slot))
+        {
+            Slot->DestroyComponent();
+        }
+    }
+
+    ParticleSlots.Empty();
+    AudioSlots.Empty();
+
+    Super::Deinitialize();
+}
+
+bool UCollectionEffectsSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UCollectionEffectsSubsystem::PlayCollectEffect(UParticleSystem* Particles, USoundBase* Sound, const FVector& Location)
+{
+    if (Particles)
+    {
+        if (UParticleSystemComponent* Emitter = GetParticleSlot())
+        {
+            Emitter->SetWorldLocation(Location);
+            if (Emitter->Template != Particles)
+            {
+                Emitter->SetTemplate(Particles);
+            }
+            Emitter->ActivateSystem(true);
+        }
+    }
+
+    if (Sound)
+    {
+        if (UAudioComponent* Voice = GetAudioSlot())
+        {
+            Voice->SetWorldLocation(Location);
+            if (Voice->Sound != Sound)
+            {
+                Voice->SetSound(Sound);
+            }
+            Voice->Play();
+        }
+    }
+}
+
+UParticleSystemComponent* UCollectionEffectsSubsystem::GetParticleSlot()
+{
+    // Prefer an idle slot
+    for (UParticleSystemComponent* Slot : ParticleSlots)
+    {
+        if (IsValid(Slot) && !Slot->IsActive())
+        {
+            return Slot;
+        }
+    }
+
+    // Grow until the cap (created once, never destroyed mid-run)
+    if (ParticleSlots.Num() < MaxParticleSlots)
+    {
+        UWorld* World = GetWorld();
+        if (!World)
+        {
+            return nullptr;
+        }
+
+        UParticleSystemComponent* Slot = NewObject<UParticleSystemComponent>(this);
+        Slot->bAutoActivate = false;
+        Slot->bAutoDestroy = false;
+        Slot->SetUsingAbsoluteLocation(true);
+        Slot->RegisterComponentWithWorld(World);
+        ParticleSlots.Add(Slot);
+        return Slot;
+    }
+
+    // All busy: restart the oldest
+    UParticleSystemComponent* Slot = ParticleSlots[NextParticleSlot];
+    NextParticleSlot = (NextParticleSlot + 1) % ParticleSlots.Num();
+    return IsValid(Slot) ? Slot : nullptr;
+}
+
+UAudioComponent* UCollectionEffectsSubsystem::GetAudioSlot()
+{
+    for (UAudioComponent* Slot : AudioSlots)
+    {
+        if (IsValid(Slot) && !Slot->IsPlaying())
+        {
+            return Slot;
+        }
+    }
+
+    if (AudioSlots.Num() < MaxVoices)
+    {
+        UWorld* World = GetWorld();
+        if (!World)
+        {
+            return nullptr;
+        }
+
+        UAudioComponent* Slot = NewObject<UAudioComponent>(this);
+        Slot->bAutoActivate = false;
+        Slot->bAutoDestroy = false;
+        Slot->bAllowSpatialization = true;
+        Slot->SetUsingAbsoluteLocation(true);
+        Slot->RegisterComponentWithWorld(World);
+        AudioSlots.Add(Slot);
+        return Slot;
+    }
+
+    // Voice cap reached: steal the oldest voice
+    UAudioComponent* Slot = AudioSlots[NextAudioSlot];
+    NextAudioSlot = (NextAudioSlot + 1) % AudioSlots.Num();
+    return IsValid(Slot) ? Slot : nullptr;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CollectionEffectsSubsystem.generated.h"
+
+class UParticleSystem;
+class UParticleSystemComponent;
+class UAudioComponent;
+class USoundBase;
+
+/**
+ * Plays one-shot pickup effects (particles + sound) from a small fixed set of reusable components.
+ * Replaces a particle component per coin and a fresh audio component per collection.
+ *
+ * PERFORMANCE: At most MaxParticleSlots emitters and MaxVoices sounds exist per world, created on
+ * first use and recycled round-robin (the oldest slot is restarted when all are busy), so dense
+ * coin arcs cost no component registration and never exceed the voice cap.
+ */
+UCLASS()
+class SIDERUNNER_API UCollectionEffectsSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+    /**
+     * Plays a collection effect at a location. Either asset may be null.
+     *
+     * @param Particles - Particle system template to play once
+     * @param Sound - Sound to play once
+     * @param Location - World location of the effect
+     */
+    UFUNCTION(BlueprintCallable, Category = "Effects")
+    void PlayCollectEffect(UParticleSystem* Particles, USoundBase* Sound, const FVector& Location);
+
+    /** Maximum pooled particle emitters per world. */
+    static constexpr int32 MaxParticleSlots = 8;
+
+    /** Maximum simultaneous collection sounds per world. */
+    static constexpr int32 MaxVoices = 4;
+
+private:
+    UParticleSystemComponent* GetParticleSlot();
+    UAudioComponent* GetAudioSlot();
+
+    UPROPERTY()
+    TArray<UParticleSystemComponent*> ParticleSlots;
+
+    UPROPERTY()
+    TArray<UAudioComponent*> AudioSlots;
+
+    /** Next slot to steal when every slot is busy */
+    int32 NextParticleSlot = 0;
+    int32 NextAudioSlot = 0;
+};
@@ -4,10 +4,124 @@
 
 UDifficultyScaler::UDifficultyScaler()
     : DifficultyOverrideCurve(nullptr)
+    , bUseBakedTable(true)
+    , BakeResolutionMeters(10.0f)
 {
 }
 
+void UDifficultyScaler::PostInitProperties()
+{
+    Super::PostInitProperties();
+    BakeDifficultyTable();
+}
+
+void UDifficultyScaler::PostLoad()
+{
+    Super::PostLoad();
+
+    // Serialized overrides (e.g. a level-placed curve) are applied by now
+    BakeDifficultyTable();
+}
+
+#if WITH_EDITOR
+void UDifficultyScaler::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+    BakeDifficultyTable();
+}
+#endif
+
+// ======================================================================
+// Baked Lookup Table
+// ======================================================================
+
+void UDifficultyScaler::BakeDifficultyTable()
+{
+    BakedTable.Reset();
+    BakedCurve = DifficultyOverrideCurve;
+
+    if (!bUseBakedTable || BakeResolutionMeters <= 0.0f)
+    {
+        return;
+    }
+
+    // Bake the span where the curve actually changes; outside it lookups evaluate directly
+    float StartMeters = 0.0f;
+    float EndMeters = DifficultyConstants::PHASE1_END_DISTANCE + DifficultyConstants::PHASE2_RAMP_LENGTH;
+    if (DifficultyOverrideCurve)
+    {
+        DifficultyOverrideCurve->GetTimeRange(StartMeters, EndMeters);
+    }
+
+    const float SpanMeters = EndMeters - StartMeters;
+    if (SpanMeters <= 0.0f)
+    {
+        return; // Single key or empty curve: direct evaluation is already O(1)
+    }
+
+    // Round the step so the last sample lands exactly on EndMeters
+    const int32 NumSamples = FMath::Clamp(FMath::CeilToInt(SpanMeters / BakeResolutionMeters) + 1,
+        2, DifficultyConstants::MAX_BAKED_SAMPLES);
+    const float StepMeters = SpanMeters / (NumSamples - 1);
+
+    BakedTable.SetNumUninitialized(NumSamples);
+    for (int32 i = 0; i < NumSamples; ++i)
+    {
+        BakedTable[i] = EvaluateDifficulty(StartMeters + i * StepMeters);
+    }
+
+    BakedStartMeters = StartMeters;
+    BakedInvStepMeters = 1.0f / StepMeters;
+
+#if UE_BUILD_DEVELOPMENT
+    UE_LOG(LogSideRunner, Verbose, TEXT("DifficultyScaler: Baked %d samples over %.0f-%.0fm (%s)"),
+           NumSamples, StartMeters, EndMeters, DifficultyOverrideCurve ? *DifficultyOverrideCurve->GetName() : TEXT("default ramp"));
+#endif
+}
+
+// ======================================================================
+// Evaluation
+// ======================================================================
+
 float UDifficultyScaler::GetDifficultyAtDistance(float DistanceMeters) const
+{
+    if (HasValidBakedTable())
+    {
+        return LookupDifficulty(DistanceMeters);
+    }
+
+    return EvaluateDifficulty(DistanceMeters);
+}
+
+TArray<float> UDifficultyScaler::GetDifficultiesAtDistances(const TArray<float>& DistancesMeters) const
+{
+    TArray<float> Difficulties;
+    Difficulties.SetNumUninitialized(DistancesMeters.Num());
+    EvaluateDifficulties(DistancesMeters, Difficulties);
+    return Difficulties;
+}
+
+void UDifficultyScaler::EvaluateDifficulties(TArrayView<const float> DistancesMeters, TArrayView<float> OutDifficulties) const
+{
+    check(DistancesMeters.Num() == OutDifficulties.Num());
+
+    // Validity is checked once for the whole batch
+    if (HasValidBakedTable())
+    {
+        for (int32 i = 0; i < DistancesMeters.Num(); ++i)
+        {
+            OutDifficulties[i] = LookupDifficulty(DistancesMeters[i]);
+        }
+        return;
+    }
+
+    for (int32 i = 0; i < DistancesMeters.Num(); ++i)
+    {
+        OutDifficulties[i] = EvaluateDifficulty(DistancesMeters[i]);
+    }
+}
+
+float UDifficultyScaler::EvaluateDifficulty(float DistanceMeters) const
 {
     // Use designer curve if provided
     if (DifficultyOverrideCurve)
@@ -21,6 +21,9 @@ namespace DifficultyConstants
 
     /** Maximum difficulty (hardest). */
     constexpr float MAX_DIFFICULTY = 10.0f;
+
+    /** Upper bound on baked table entries (caps memory for very long or very fine curves). */
+    constexpr int32 MAX_BAKED_SAMPLES = 65536;
 }
 
 /**
@@ -31,6 +34,9 @@ namespace DifficultyConstants
  * then slower ramp to 10.0 at 20000m.
  *
  * Optionally overridden via a designer-authored UCurveFloat.
+ *
+ * PERFORMANCE: The active curve is baked into a fixed-resolution table, so lookups are
+ * an index computation and one lerp instead of a curve key search per call.
  */
 UCLASS(BlueprintType, Blueprintable)
 class SIDERUNNER_API UDifficultyScaler : public UObject
@@ -40,6 +46,13 @@ class SIDERUNNER_API UDifficultyScaler : public UObject
 public:
     UDifficultyScaler();
 
+    virtual void PostInitProperties() override;
+    virtual void PostLoad() override;
+
+#if WITH_EDITOR
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
     /**
      * Returns the difficulty level for the given distance.
      *
@@ -58,11 +71,75 @@ public:
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Difficulty")
     float GetDifficultyAlpha(float DistanceMeters) const;
 
+    /**
+     * Returns the difficulty for each distance in one call (e.g. several chunks of look-ahead).
+     *
+     * @param DistancesMeters - Player distances in meters
+     * @return Difficulty between 1.0 and 10.0 per distance, index-aligned with the input
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Difficulty")
+    TArray<float> GetDifficultiesAtDistances(const TArray<float>& DistancesMeters) const;
+
+    /**
+     * Allocation-free batch evaluation into a caller-owned buffer.
+     *
+     * @param DistancesMeters - Player distances in meters
+     * @param OutDifficulties - Receives one difficulty per distance (must be the same length)
+     */
+    void EvaluateDifficulties(TArrayView<const float> DistancesMeters, TArrayView<float> OutDifficulties) const;
+
+    /**
+     * Re-samples the active curve into the lookup table.
+     * Called automatically on load and on edit; call manually after changing the
+     * override curve or its keys at runtime (a swapped curve is detected and evaluated directly until then).
+     */
+    UFUNCTION(BlueprintCallable, Category = "Difficulty")
+    void BakeDifficultyTable();
+
     /** Optional designer-authored curve override. X = meters, Y = difficulty (1-10). */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Difficulty")
     class UCurveFloat* DifficultyOverrideCurve;
 
+    /** Answer lookups from the baked table instead of evaluating the curve each call. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Difficulty|Baked Table")
+    bool bUseBakedTable;
+
+    /** Distance between baked samples in meters (smaller = closer to a curved override). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Difficulty|Baked Table", meta = (ClampMin = "0.1", ClampMax = "1000.0"))
+    float BakeResolutionMeters;
+
 private:
+    /** Evaluates the active curve (override or default) without the table. */
+    float EvaluateDifficulty(float DistanceMeters) const;
+
+    /** Interpolated table lookup, falling back to direct evaluation outside the baked range. */
+    FORCEINLINE float LookupDifficulty(float DistanceMeters) const
+    {
+        const float Index = (DistanceMeters - BakedStartMeters) * BakedInvStepMeters;
+        const int32 LastIndex = BakedTable.Num() - 1;
+        if (Index >= 0.0f && Index <= static_cast<float>(LastIndex))
+        {
+            const int32 Lower = FMath::Min(FMath::FloorToInt(Index), LastIndex - 1);
+            return FMath::Lerp(BakedTable[Lower], BakedTable[Lower + 1], Index - static_cast<float>(Lower));
+        }
+        return EvaluateDifficulty(DistanceMeters);
+    }
+
+    /** True if the table exists and was baked from the current override curve. */
+    FORCEINLINE bool HasValidBakedTable() const
+    {
+        return bUseBakedTable && BakedTable.Num() >= 2 && BakedCurve == DifficultyOverrideCurve;
+    }
+
     /** Default built-in difficulty calculation (dual-slope linear ramp). */
     float CalculateDefaultDifficulty(float DistanceMeters) const;
+
+    /** Difficulty sampled every BakedStepMeters from BakedStartMeters. */
+    TArray<float> BakedTable;
+
+    float BakedStartMeters = 0.0f;
+    float BakedInvStepMeters = 0.0f;
+
+    /** Override curve the table was baked from (nullptr = default ramp). Not a GC reference. */
+    const UCurveFloat* BakedCurve = nullptr;
 };
@@ -31,9 +31,137 @@ struct FPlatformPlacement
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Placement")
     bool bIsMoving = false;
 
+    /** Half-range of the platform's Y oscillation around YPosition (0 = static) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Placement")
+    float MoveAmplitude = 0.0f;
+
+    /** Seconds per full back-and-forth cycle */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Placement")
+    float MovePeriod = 0.0f;
+
+    /** Cycle offset in radians, so neighbouring platforms don't move in lockstep */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Placement")
+    float MovePhase = 0.0f;
+
     /** Whether a collectible should be spawned above this platform */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Placement")
     bool bHasCollectible = false;
+
+    /** Index into the builder's PlatformVariants (INDEX_NONE = base PlatformClass) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Placement")
+    int32 VariantIndex = INDEX_NONE;
+};
+
+/**
+ * Placement data for a single obstacle in a procedurally generated chunk.
+ */
+USTRUCT(BlueprintType)
+struct FObstaclePlacement
+{
+    GENERATED_BODY()
+
+    /** Y-axis position (forward direction) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Placement")
+    float YPosition = 0.0f;
+
+    /** Z-axis position (height) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Placement")
+    float ZPosition = 0.0f;
+
+    /** Index into the builder's ObstacleClasses */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Placement")
+    int32 ClassIndex = 0;
+
+    /** EMovementType value to apply to the spawned spike */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Placement")
+    uint8 MovementType = 0;
+
+    /** Index of the platform the obstacle sits on */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Placement")
+    int32 PlatformIndex = INDEX_NONE;
+};
+
+/**
+ * Placement data for a single enemy in a procedurally generated chunk.
+ */
+USTRUCT(BlueprintType)
+struct FEnemyPlacement
+{
+    GENERATED_BODY()
+
+    /** Y-axis position (forward direction), also the patrol origin */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Placement")
+    float YPosition = 0.0f;
+
+    /** Z-axis position (height) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Placement")
+    float ZPosition = 0.0f;
+
+    /** Patrol distance each way from the origin, sized to stay on the platform */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Placement")
+    float PatrolDistance = 0.0f;
+};
+
+/**
+ * Spawn-free layout of a single procedural chunk.
+ * All positions are chunk-local: Y is relative to the chunk start, so a layout
+ * can be generated off the game thread and spawned at any world offset.
+ */
+USTRUCT(BlueprintType)
+struct FChunkLayout
+{
+    GENERATED_BODY()
+
+    /** Run seed this layout was generated from */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Layout")
+    int32 Seed = 0;
+
+    /** Chunk index within the run */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Layout")
+    int32 ChunkIndex = 0;
+
+    /** Clamped difficulty used for generation (1.0 to 10.0) */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Layout")
+    float Difficulty = 1.0f;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Layout")
+    TArray<FPlatformPlacement> Platforms;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Layout")
+    TArray<FObstaclePlacement> Obstacles;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Layout")
+    TArray<FEnemyPlacement> Enemies;
+
+    /** Coin positions as (Y, Z) */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Layout")
+    TArray<FVector2D> Coins;
+
+    /** Whether the rare wall spike event fires for this chunk */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Layout")
+    bool bHasWallSpike = false;
+
+    /** Wall spike position as (Y, Z) — only valid when bHasWallSpike */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Layout")
+    FVector2D WallSpikeLocation = FVector2D::ZeroVector;
+};
+
+/**
+ * Designer weights for picking between options (e.g. obstacle classes) from a given difficulty up.
+ * The active band for a difficulty is the last band whose MinDifficulty does not exceed it.
+ */
+USTRUCT(BlueprintType)
+struct FSelectionWeightBand
+{
+    GENERATED_BODY()
+
+    /** Lowest difficulty (inclusive) this band applies to */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weights", meta = (ClampMin = "1.0", ClampMax = "10.0"))
+    float MinDifficulty = 1.0f;
+
+    /** Relative weight per option, index-aligned with the option array. Missing entries weigh 1. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weights", meta = (ClampMin = "0.0"))
+    TArray<float> Weights;
 };
 
 /**
@@ -68,3 +196,95 @@ enum class EProceduralFeature : uint8
     GapChallenge     UMETA(DisplayName = "Gap Challenge"),
     CoinRun          UMETA(DisplayName = "Coin Run")
 };
+
+/**
+ * How UProceduralLevelBuilder lays out platforms, obstacles and coins.
+ */
+UENUM(BlueprintType)
+enum class EChunkGeneratorMode : uint8
+{
+    /** Per-platform controlled random walk with difficulty-driven widths and gaps */
+    RandomWalk       UMETA(DisplayName = "Random Walk"),
+
+    /** Chunks composed from authored feature patterns, picked per difficulty */
+    PatternLibrary   UMETA(DisplayName = "Pattern Library")
+};
+
+/**
+ * One platform row of an authored feature pattern.
+ */
+USTRUCT(BlueprintType)
+struct FFeaturePatternElement
+{
+    GENERATED_BODY()
+
+    /** Gap from the previous platform's far edge (clamped to the jumpable range on expansion) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pattern", meta = (ClampMin = "0.0"))
+    float GapBefore = 200.0f;
+
+    /** Platform width along Y-axis */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pattern", meta = (ClampMin = "50.0"))
+    float Width = 300.0f;
+
+    /** Height above the base ground level */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pattern")
+    float Height = 0.0f;
+
+    /** Whether the platform oscillates (uses the builder's moving platform settings) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pattern")
+    bool bMoving = false;
+
+    /** Whether an obstacle sits on the platform (ignored on moving platforms) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pattern")
+    bool bObstacle = false;
+
+    /** Coins spread evenly above the platform */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pattern", meta = (ClampMin = "0", ClampMax = "8"))
+    int32 Coins = 0;
+
+    /** Whether a coin arc spans the gap before this platform */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pattern")
+    bool bCoinArc = false;
+};
+
+/**
+ * Authored run of platforms that the pattern-library generator places as a unit.
+ */
+USTRUCT(BlueprintType)
+struct FFeaturePattern
+{
+    GENERATED_BODY()
+
+    /** Feature this pattern showcases (for designers and stats) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pattern")
+    EProceduralFeature Feature = EProceduralFeature::StaticPlatform;
+
+    /** Lowest difficulty (inclusive) this pattern can appear at */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pattern", meta = (ClampMin = "1.0", ClampMax = "10.0"))
+    float MinDifficulty = 1.0f;
+
+    /** Highest difficulty (inclusive) this pattern can appear at */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pattern", meta = (ClampMin = "1.0", ClampMax = "10.0"))
+    float MaxDifficulty = 10.0f;
+
+    /** Relative pick weight among the patterns available at a difficulty */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pattern", meta = (ClampMin = "0.0"))
+    float Weight = 1.0f;
+
+    /** Platforms in order along Y */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pattern")
+    TArray<FFeaturePatternElement> Elements;
+};
+
+/**
+ * How a chunk's actors are put to sleep when a level is deactivated or pooled.
+ */
+UENUM(BlueprintType)
+enum class EChunkDormancyMode : uint8
+{
+    /** Toggle hidden/collision/tick flags on every actor (collision filter and overlap update per component) */
+    PerActor   UMETA(DisplayName = "Per Actor"),
+
+    /** Hidden/tick flags, but physics bodies are dropped on sleep and recreated in one deferred batch on wake */
+    Bulk       UMETA(DisplayName = "Bulk")
+};
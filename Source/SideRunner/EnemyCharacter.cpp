@@ -736,34 +736,14 @@ void AEnemyCharacter::DefeatEnemy()
 
 		// Destroy after death animation finishes
 		const float DeathDuration = DeathFlipbook->GetTotalDuration();
-		GetWorldTimerManager().SetTimer(
-			DeathTimerHandle,
-			FTimerDelegate::CreateLambda([WeakThis = TWeakObjectPtr<AEnemyCharacter>(this)]()
-			{
-				if (WeakThis.IsValid())
-				{
-					WeakThis->Destroy();
-				}
-			}),
-			DeathDuration + 0.1f,
-			false
-		);
+		GetWorldTimerManager().SetTimer(DeathTimerHandle, this, &AEnemyCharacter::FinishDefeat,
+			DeathDuration + 0.1f, false);
 	}
 	else
 	{
 		// No death anim — destroy immediately with small delay for FX
-		GetWorldTimerManager().SetTimer(
-			DeathTimerHandle,
-			FTimerDelegate::CreateLambda([WeakThis = TWeakObjectPtr<AEnemyCharacter>(this)]()
-			{
-				if (WeakThis.IsValid())
-				{
-					WeakThis->Destroy();
-				}
-			}),
-			0.15f,
-			false
-		);
+		GetWorldTimerManager().SetTimer(DeathTimerHandle, this, &AEnemyCharacter::FinishDefeat,
+			0.15f, false);
 	}
 
 	// BP event for FX/audio (score increment, particles, sound)
@@ -771,3 +751,73 @@ void AEnemyCharacter::DefeatEnemy()
 
 	UE_LOG(LogSideRunnerEnemy, Log, TEXT("Enemy [%s] defeated and scheduled for destruction"), *GetName());
 }
+
+void AEnemyCharacter::FinishDefeat()
+{
+	// Pooled enemies stay with their chunk until it is recycled
+	if (bManagedByPool)
+	{
+		SetActorHiddenInGame(true);
+		return;
+	}
+
+	Destroy();
+}
+
+// ============================================================================
+// Pooling
+// ============================================================================
+
+void AEnemyCharacter::ResetForReuse(float InPatrolDistance)
+{
+	bManagedByPool = true;
+
+	// Clear anything left from the previous placement (death timer, patrol pause)
+	GetWorldTimerManager().ClearTimer(DeathTimerHandle);
+	StopPatrolTimer();
+
+	bIsDead = false;
+	SetActorHiddenInGame(false);
+
+	// New patrol origin — PatrolWaypoints are local offsets from it, so they follow the placement
+	PatrolOrigin = GetActorLocation();
+	if (InPatrolDistance > 0.0f)
+	{
+		PatrolDistance = InPatrolDistance;
+	}
+	PreviousNodeIndex = INDEX_NONE;
+
+	// Restore collision disabled by DefeatEnemy
+	GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+	if (DamageZone) DamageZone->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	if (StompZone) StompZone->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+
+	if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
+	{
+		MoveComp->StopMovementImmediately();
+		MoveComp->SetMovementMode(MOVE_Walking);
+		MoveComp->MaxWalkSpeed = PatrolSpeed;
+	}
+
+	// Back to the walk loop, facing forward
+	if (EnemySprite && WalkFlipbook)
+	{
+		EnemySprite->SetFlipbook(WalkFlipbook);
+		EnemySprite->SetLooping(true);
+		EnemySprite->PlayFromStart();
+	}
+
+	StartPatrolFromBeginning();
+	UpdateSpriteDirection();
+}
+
+void AEnemyCharacter::DeactivateForPool()
+{
+	StopPatrolTimer();
+	GetWorldTimerManager().ClearTimer(DeathTimerHandle);
+
+	if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
+	{
+		MoveComp->StopMovementImmediately();
+	}
+}
@@ -141,10 +141,20 @@ public:
 	UFUNCTION(BlueprintImplementableEvent, Category = "Combat")
 	void OnDamagedPlayer(AActor* Player);
 
-	/** Kill this enemy — plays death anim then destroys */
+	/** Kill this enemy — plays death anim then destroys (pooled enemies hide instead) */
 	UFUNCTION(BlueprintCallable, Category = "Combat")
 	void DefeatEnemy();
 
+	// --- Pooling ---
+
+	/** Re-arms a pooled enemy at its current location: patrol origin and waypoint state,
+	 *  dead flag, collision, movement and sprite. Marks the enemy as pool-managed.
+	 *  @param InPatrolDistance Simple-patrol distance for this placement (<= 0 keeps the current value) */
+	void ResetForReuse(float InPatrolDistance);
+
+	/** Stops patrol/pause/death timers before the enemy sleeps in a pool (dormancy does not). */
+	void DeactivateForPool();
+
 	/** Sums all PatrolNodes durations using Algo::Accumulate. Returns 0 for empty arrays. */
 	UFUNCTION(BlueprintCallable, Category = "Patrol|Nodes")
 	int32 CalculatePatrolMetric();
@@ -179,6 +189,9 @@ private:
 	bool bIsPatrolling = false;
 	bool bIsDead = false;
 
+	/** True once placed by UProceduralLevelBuilder — defeat hides instead of destroying. */
+	bool bManagedByPool = false;
+
 	FTimerHandle PatrolTimerHandle;
 	FTimerHandle PauseTimerHandle;
 	FTimerHandle DeathTimerHandle;
@@ -222,4 +235,7 @@ private:
 		const FHitResult& SweepResult);
 
 	void UpdateSpriteDirection();
+
+	/** Death timer callback: destroys the enemy, or hides it until its chunk is recycled. */
+	void FinishDefeat();
 };
@@ -0,0 +1,148 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EndlessRunnerTypes.h"
+#include "AliasTable.h"
+
+/**
+ * Authored feature patterns compiled into flat, index-aligned tables.
+ * In pattern-library mode a chunk is laid out by sampling patterns for its difficulty
+ * and expanding their element rows, instead of a per-platform random walk.
+ *
+ * PERFORMANCE: Element fields live in contiguous per-field arrays and each pattern is a
+ * (first, count) range into them; picking a pattern is one alias-table sample.
+ * Immutable after Compile — safe to share across worker threads.
+ */
+struct FFeaturePatternTable
+{
+    static constexpr uint8 FlagMoving = 1 << 0;
+    static constexpr uint8 FlagObstacle = 1 << 1;
+    static constexpr uint8 FlagCoinArc = 1 << 2;
+
+    // Element rows (index-aligned)
+    TArray<float> GapBefore;
+    TArray<float> Width;
+    TArray<float> Height;
+    TArray<uint8> CoinSlots;
+    TArray<uint8> Flags;
+
+    // Pattern ranges into the element rows (index-aligned)
+    TArray<int32> PatternFirst;
+    TArray<int32> PatternNum;
+    TArray<EProceduralFeature> PatternFeature;
+
+    /** Hash of the compiled content (part of layout cache keys) */
+    uint32 Hash = 0;
+
+    /**
+     * Flattens the authored patterns and bakes one pick table per whole difficulty level.
+     * Patterns without elements are skipped.
+     *
+     * @param Patterns - Authored patterns
+     * @param NumDifficultyBands - Number of whole difficulty levels to bake (difficulty 1 upward)
+     */
+    void Compile(const TArray<FFeaturePattern>& Patterns, int32 NumDifficultyBands)
+    {
+        GapBefore.Reset();
+        Width.Reset();
+        Height.Reset();
+        CoinSlots.Reset();
+        Flags.Reset();
+        PatternFirst.Reset();
+        PatternNum.Reset();
+        PatternFeature.Reset();
+
+        TArray<const FFeaturePattern*, TInlineAllocator<16>> Compiled;
+        uint32 NewHash = 0;
+
+        for (const FFeaturePattern& Pattern : Patterns)
+        {
+            if (Pattern.Elements.Num() == 0)
+            {
+                continue;
+            }
+
+            Compiled.Add(&Pattern);
+            PatternFirst.Add(GapBefore.Num());
+            PatternNum.Add(Pattern.Elements.Num());
+            PatternFeature.Add(Pattern.Feature);
+
+            NewHash = HashCombine(NewHash, GetTypeHash(static_cast<uint8>(Pattern.Feature)));
+            NewHash = HashCombine(NewHash, GetTypeHash(Pattern.MinDifficulty));
+            NewHash = HashCombine(NewHash, GetTypeHash(Pattern.MaxDifficulty));
+            NewHash = HashCombine(NewHash, GetTypeHash(Pattern.Weight));
+
+            for (const FFeaturePatternElement& Element : Pattern.Elements)
+            {
+                uint8 ElementFlags = 0;
+                ElementFlags |= Element.bMoving ? FlagMoving : 0;
+                ElementFlags |= (Element.bObstacle && !Element.bMoving) ? FlagObstacle : 0;
+                ElementFlags |= Element.bCoinArc ? FlagCoinArc : 0;
+
+                GapBefore.Add(FMath::Max(0.0f, Element.GapBefore));
+                Width.Add(FMath::Max(1.0f, Element.Width));
+                Height.Add(Element.Height);
+                CoinSlots.Add(static_cast<uint8>(FMath::Clamp(Element.Coins, 0, 8)));
+                Flags.Add(ElementFlags);
+
+                NewHash = HashCombine(NewHash, GetTypeHash(Element.GapBefore));
+                NewHash = HashCombine(NewHash, GetTypeHash(Element.Width));
+                NewHash = HashCombine(NewHash, GetTypeHash(Element.Height));
+                NewHash = HashCombine(NewHash, GetTypeHash(Element.Coins));
+                NewHash = HashCombine(NewHash, GetTypeHash(ElementFlags));
+            }
+        }
+
+        // One table per difficulty level; a level with no eligible pattern keeps an empty table
+        BandTables.SetNum(NumDifficultyBands);
+        TArray<float, TInlineAllocator<16>> Weights;
+        for (int32 BandIndex = 0; BandIndex < NumDifficultyBands; ++BandIndex)
+        {
+            const float BandDifficulty = static_cast<float>(BandIndex + 1);
+
+            Weights.Reset();
+            bool bAnyEligible = false;
+            for (const FFeaturePattern* Pattern : Compiled)
+            {
+                const bool bEligible = Pattern->MinDifficulty <= BandDifficulty && BandDifficulty <= Pattern->MaxDifficulty
+                    && Pattern->Weight > 0.0f;
+                Weights.Add(bEligible ? Pattern->Weight : 0.0f);
+                bAnyEligible |= bEligible;
+            }
+
+            BandTables[BandIndex].Build(bAnyEligible ? TArrayView<const float>(Weights) : TArrayView<const float>());
+        }
+
+        Hash = HashCombine(NewHash, GetTypeHash(PatternFirst.Num()));
+    }
+
+    /**
+     * Picks a pattern for the given difficulty.
+     *
+     * @param Difficulty - Difficulty level (1.0 to 10.0)
+     * @param RandomBits - Uniform random bits from FChunkRandom
+     * @return Pattern index, or INDEX_NONE if no pattern covers the difficulty
+     */
+    int32 SamplePattern(float Difficulty, uint32 RandomBits) const
+    {
+        const int32 BandIndex = FMath::Clamp(FMath::FloorToInt(Difficulty), 1, BandTables.Num()) - 1;
+        return BandTables.IsValidIndex(BandIndex) ? BandTables[BandIndex].Sample(RandomBits) : INDEX_NONE;
+    }
+
+    /** Returns true if at least one pattern can be picked at the given difficulty. */
+    bool HasPatternsFor(float Difficulty) const
+    {
+        const int32 BandIndex = FMath::Clamp(FMath::FloorToInt(Difficulty), 1, BandTables.Num()) - 1;
+        return BandTables.IsValidIndex(BandIndex) && BandTables[BandIndex].Num() > 0;
+    }
+
+    /** Returns the number of compiled patterns. */
+    int32 NumPatterns() const
+    {
+        return PatternFirst.Num();
+    }
+
+private:
+    /** Pattern pick table per whole difficulty level */
+    TArray<FAliasTable> BandTables;
+};
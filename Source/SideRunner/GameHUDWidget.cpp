@@ -2,6 +2,8 @@
 #include "Components/TextBlock.h"
 #include "SideRunner.h" // Custom log categories
 #include "SideRunnerGameInstance.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
 
 // UI Constants for Lives Display
 namespace UIConstants
@@ -18,6 +20,9 @@ void UGameHUDWidget::NativeConstruct()
 {
     Super::NativeConstruct();
 
+    ZeroScoreText = FText::FromString(TEXT("Score: 0"));
+    ZeroDistanceText = FText::FromString(TEXT("Distance: 0 m"));
+
     // Cache game instance
     CachedGameInstance = Cast<USideRunnerGameInstance>(GetGameInstance());
 
@@ -50,6 +55,16 @@ void UGameHUDWidget::NativeDestruct()
         CachedGameInstance->OnDistanceUpdated.RemoveAll(this);
     }
 
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(TextRefreshTimerHandle);
+    }
+
+#if UE_BUILD_DEVELOPMENT
+    UE_LOG(LogSideRunner, Verbose, TEXT("GameHUDWidget: %d text updates, %d unchanged values skipped"),
+        NumTextUpdates, NumTextUpdatesSkipped);
+#endif
+
     Super::NativeDestruct();
 }
 
@@ -57,8 +72,32 @@ void UGameHUDWidget::UpdateLivesDisplay(int32 CurrentLives, int32 MaxLives)
 {
     if (LivesText)
     {
-        const FString LivesString = FString::Printf(TEXT("Lives: %d/%d"), CurrentLives, MaxLives);
-        LivesText->SetText(FText::FromString(LivesString));
+        // PERFORMANCE: Lives change rarely; skip identical updates entirely
+        if (CurrentLives == DisplayedLives && MaxLives == DisplayedMaxLives)
+        {
+#if UE_BUILD_DEVELOPMENT
+            NumTextUpdatesSkipped++;
+#endif
+            return;
+        }
+
+        if (MaxLives != DisplayedMaxLives)
+        {
+            LivesTextCache.Reset();
+            for (int32 Lives = 0; Lives <= FMath::Clamp(MaxLives, 0, 99); ++Lives)
+            {
+                LivesTextCache.Add(FText::FromString(FString::Printf(TEXT("Lives: %d/%d"), Lives, MaxLives)));
+            }
+        }
+
+        DisplayedLives = CurrentLives;
+        DisplayedMaxLives = MaxLives;
+        LivesText->SetText(LivesTextCache.IsValidIndex(CurrentLives)
+            ? LivesTextCache[CurrentLives]
+            : FText::FromString(FString::Printf(TEXT("Lives: %d/%d"), CurrentLives, MaxLives)));
+#if UE_BUILD_DEVELOPMENT
+        NumTextUpdates++;
+#endif
 
         // Change color based on lives remaining
         if (CurrentLives <= UIConstants::LIVES_CRITICAL_THRESHOLD)
@@ -84,8 +123,14 @@ void UGameHUDWidget::UpdateScoreDisplay(int32 CurrentScore)
 {
     if (ScoreText)
     {
-        const FString ScoreString = FString::Printf(TEXT("Score: %d"), CurrentScore);
-        ScoreText->SetText(FText::FromString(ScoreString));
+        PendingScore = CurrentScore;
+#if UE_BUILD_DEVELOPMENT
+        if (PendingScore == DisplayedScore)
+        {
+            NumTextUpdatesSkipped++;
+        }
+#endif
+        RequestTextRefresh();
     }
     else
     {
@@ -97,8 +142,15 @@ void UGameHUDWidget::UpdateDistanceDisplay(float DistanceMeters)
 {
     if (DistanceText)
     {
-        const FString DistString = FString::Printf(TEXT("Distance: %.0f m"), DistanceMeters);
-        DistanceText->SetText(FText::FromString(DistString));
+        // Matches the previous "%.0f" formatting
+        PendingDistance = FMath::RoundToInt(DistanceMeters);
+#if UE_BUILD_DEVELOPMENT
+        if (PendingDistance == DisplayedDistance)
+        {
+            NumTextUpdatesSkipped++;
+        }
+#endif
+        RequestTextRefresh();
     }
     else
     {
@@ -106,6 +158,60 @@ void UGameHUDWidget::UpdateDistanceDisplay(float DistanceMeters)
     }
 }
 
+void UGameHUDWidget::RequestTextRefresh()
+{
+    const UWorld* World = GetWorld();
+    if (TextRefreshInterval <= 0.0f || !World)
+    {
+        FlushPendingText();
+        return;
+    }
+
+    // PERFORMANCE: Throttled - a pending timer will pick up the latest value
+    if (World->GetTimerManager().IsTimerActive(TextRefreshTimerHandle))
+    {
+        return;
+    }
+
+    const double Now = World->GetTimeSeconds();
+    const double SinceLast = Now - LastTextRefreshTime;
+    if (LastTextRefreshTime < 0.0 || SinceLast >= TextRefreshInterval)
+    {
+        FlushPendingText();
+        return;
+    }
+
+    World->GetTimerManager().SetTimer(TextRefreshTimerHandle, this, &UGameHUDWidget::FlushPendingText,
+        static_cast<float>(TextRefreshInterval - SinceLast), false);
+}
+
+void UGameHUDWidget::FlushPendingText()
+{
+    if (const UWorld* World = GetWorld())
+    {
+        LastTextRefreshTime = World->GetTimeSeconds();
+    }
+
+    // PERFORMANCE: Only touch a TextBlock (and build a string) when its displayed integer changes
+    if (ScoreText && PendingScore != DisplayedScore)
+    {
+        DisplayedScore = PendingScore;
+        ScoreText->SetText(PendingScore == 0 ? ZeroScoreText : FText::FromString(FString::Printf(TEXT("Score: %d"), PendingScore)));
+#if UE_BUILD_DEVELOPMENT
+        NumTextUpdates++;
+#endif
+    }
+
+    if (DistanceText && PendingDistance != DisplayedDistance)
+    {
+        DisplayedDistance = PendingDistance;
+        DistanceText->SetText(PendingDistance == 0 ? ZeroDistanceText : FText::FromString(FString::Printf(TEXT("Distance: %d m"), PendingDistance)));
+#if UE_BUILD_DEVELOPMENT
+        NumTextUpdates++;
+#endif
+    }
+}
+
 void UGameHUDWidget::OnLivesUpdatedHandler(int32 CurrentLives, int32 MaxLives)
 {
     UpdateLivesDisplay(CurrentLives, MaxLives);
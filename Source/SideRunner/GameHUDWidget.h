@@ -15,6 +15,8 @@
  * - Add to viewport at game start via GameMode or PlayerController
  *
  * Performance: Updates only when GameInstance delegates fire (event-driven, not Tick-based).
+ * Text is rebuilt only when the displayed integer changes, and score/distance can be throttled
+ * with TextRefreshInterval, so per-frame distance events normally cost a compare, not a string.
  */
 UCLASS()
 class SIDERUNNER_API UGameHUDWidget : public UUserWidget
@@ -50,6 +52,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "UI")
     void UpdateDistanceDisplay(float DistanceMeters);
 
+    /**
+     * Minimum seconds between score/distance text refreshes (0 = refresh on every change).
+     * The latest value is always shown once the interval has passed.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UI", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float TextRefreshInterval = 0.0f;
+
 protected:
     virtual void NativeConstruct() override;
     virtual void NativeDestruct() override;
@@ -87,4 +96,43 @@ private:
 
     UFUNCTION()
     void OnDistanceUpdatedHandler(float NewDistance);
+
+    // ======================================================================
+    // Cached Text State
+    // ======================================================================
+
+    /** Value currently shown by each TextBlock (MIN_int32 = nothing shown yet) */
+    int32 DisplayedLives = MIN_int32;
+    int32 DisplayedMaxLives = MIN_int32;
+    int32 DisplayedScore = MIN_int32;
+    int32 DisplayedDistance = MIN_int32;
+
+    /** Latest values received, applied on the next refresh */
+    int32 PendingScore = 0;
+    int32 PendingDistance = 0;
+
+    /** World time of the last score/distance refresh */
+    double LastTextRefreshTime = -1.0;
+
+    /** One-shot timer that flushes values throttled by TextRefreshInterval */
+    FTimerHandle TextRefreshTimerHandle;
+
+    /** Preformatted "Lives: N/Max" for N in [0, Max], rebuilt when Max changes */
+    TArray<FText> LivesTextCache;
+
+    /** Preformatted zero values (shown at every run start) */
+    FText ZeroScoreText;
+    FText ZeroDistanceText;
+
+#if UE_BUILD_DEVELOPMENT
+    /** Text refresh counters, logged on destruct */
+    int32 NumTextUpdates = 0;
+    int32 NumTextUpdatesSkipped = 0;
+#endif
+
+    /** Applies pending score/distance now, or arms the refresh timer if throttled. */
+    void RequestTextRefresh();
+
+    /** Pushes pending score/distance to their TextBlocks if the displayed value changed. */
+    void FlushPendingText();
 };
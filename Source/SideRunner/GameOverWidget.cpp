@@ -2,6 +2,7 @@
 #include "Components/TextBlock.h"
 #include "Components/Button.h"
 #include "Kismet/GameplayStatics.h"
+#include "RunnerCharacter.h"
 
 void UGameOverWidget::NativeConstruct()
 {
@@ -40,6 +41,20 @@ void UGameOverWidget::OnRestartClicked()
     // Remove this widget
     RemoveFromParent();
 
+    // PERFORMANCE: Restart in place (no map reload) when the runner is available
+    if (ARunnerCharacter* Runner = Cast<ARunnerCharacter>(GetOwningPlayerPawn()))
+    {
+        if (APlayerController* PC = GetOwningPlayer())
+        {
+            // OpenLevel used to restore these implicitly
+            PC->SetInputMode(FInputModeGameOnly());
+            PC->SetShowMouseCursor(false);
+        }
+
+        Runner->RestartLevel();
+        return;
+    }
+
     // Reload the current level
     const FString CurrentLevel = UGameplayStatics::GetCurrentLevelName(this, true);
     UGameplayStatics::OpenLevel(this, FName(*CurrentLevel), false);
@@ -4,8 +4,7 @@
 #include "Components/ProgressBar.h"
 #include "Components/TextBlock.h"
 #include "RunnerCharacter.h"
-#include "Kismet/GameplayStatics.h"
-#include "TimerManager.h"
+#include "SideRunnerGameInstance.h"
 #include "SideRunner.h" // Custom log categories
 
 UHealthBarWidget::UHealthBarWidget(const FObjectInitializer& ObjectInitializer)
@@ -26,17 +25,30 @@ void UHealthBarWidget::NativeConstruct()
 		return;
 	}
 
-	// Attempt to bind to health component (with retry mechanism)
-	TryBindToHealthComponent();
+	// PERFORMANCE: Event-driven binding - the character announces itself, so nothing polls for it
+	CachedGameInstance = Cast<USideRunnerGameInstance>(GetGameInstance());
+	if (!CachedGameInstance)
+	{
+		UE_LOG(LogSideRunner, Error, TEXT("HealthBarWidget: Failed to get SideRunnerGameInstance!"));
+		return;
+	}
+
+	CachedGameInstance->OnPlayerCharacterReady.AddUniqueDynamic(this, &UHealthBarWidget::OnPlayerCharacterReady);
+
+	// Character registered before this widget existed - bind now
+	if (ARunnerCharacter* PlayerCharacter = CachedGameInstance->GetPlayerCharacter())
+	{
+		OnPlayerCharacterReady(PlayerCharacter);
+	}
 }
 
 void UHealthBarWidget::NativeDestruct()
 {
-	// Clear retry timer if still running
-	if (BindRetryTimerHandle.IsValid())
+	if (IsValid(CachedGameInstance))
 	{
-		GetWorld()->GetTimerManager().ClearTimer(BindRetryTimerHandle);
+		CachedGameInstance->OnPlayerCharacterReady.RemoveAll(this);
 	}
+	CachedGameInstance = nullptr;
 
 	// Unbind from health component to prevent dangling references
 	UnbindFromHealthComponent();
@@ -206,89 +218,71 @@ float UHealthBarWidget::GetHealthPercent() const
 // Health Component Binding
 // ============================================================================
 
-void UHealthBarWidget::TryBindToHealthComponent()
+void UHealthBarWidget::OnPlayerCharacterReady(ARunnerCharacter* PlayerCharacter)
 {
-	// Attempt binding
-	if (BindToHealthComponent())
+	if (!IsValid(PlayerCharacter))
+	{
+		return;
+	}
+
+	// Ignore other players' characters (the controller may not be assigned yet during BeginPlay)
+	const AController* CharacterController = PlayerCharacter->GetController();
+	if (CharacterController && GetOwningPlayer() && CharacterController != GetOwningPlayer())
+	{
+		return;
+	}
+
+	// Respawn keeps the same character and component - only a new one needs rebinding
+	if (PlayerCharacter != OwningCharacter || PlayerCharacter->HealthComponent != HealthComponent)
 	{
-		// Success - clear retry timer if it was set
-		if (BindRetryTimerHandle.IsValid())
+		UnbindFromHealthComponent();
+		if (!BindToHealthComponent(PlayerCharacter))
 		{
-			GetWorld()->GetTimerManager().ClearTimer(BindRetryTimerHandle);
+			return;
 		}
 
 #if UE_BUILD_DEVELOPMENT
 		UE_LOG(LogSideRunner, Log, TEXT("HealthBarWidget: Successfully bound to health component"));
 #endif
-
-		// Initialize visual state
-		UpdateHealthBar();
-		UpdateHitCounter();
-	}
-	else
-	{
-		// Failed - set up retry timer if not already running
-		if (!BindRetryTimerHandle.IsValid())
-		{
-			UE_LOG(LogSideRunner, Warning, TEXT("HealthBarWidget: Failed to bind to health component - retrying every 0.1s"));
-
-			// Retry every 0.1 seconds until successful
-			GetWorld()->GetTimerManager().SetTimer(
-				BindRetryTimerHandle,
-				this,
-				&UHealthBarWidget::TryBindToHealthComponent,
-				0.1f,
-				true  // Loop
-			);
-		}
 	}
+
+	// Initialize visual state
+	SyncFromHealthComponent();
+	UpdateHealthBar();
+	UpdateHitCounter();
 }
 
-bool UHealthBarWidget::BindToHealthComponent()
+bool UHealthBarWidget::BindToHealthComponent(ARunnerCharacter* PlayerCharacter)
 {
-	// Try to get the owning player's character
-	APlayerController* PlayerController = GetOwningPlayer();
-	if (!PlayerController)
+	// Get the health component
+	UPlayerHealthComponent* CharacterHealth = PlayerCharacter->HealthComponent;
+	if (!IsValid(CharacterHealth))
 	{
-		UE_LOG(LogSideRunner, Warning, TEXT("HealthBarWidget: No owning player controller"));
+		UE_LOG(LogSideRunner, Error, TEXT("HealthBarWidget: RunnerCharacter has no HealthComponent!"));
 		return false;
 	}
 
-	// Get the controlled pawn
-	APawn* ControlledPawn = PlayerController->GetPawn();
-	if (!ControlledPawn)
-	{
-		UE_LOG(LogSideRunner, Warning, TEXT("HealthBarWidget: Player controller has no pawn"));
-		return false;
-	}
+	OwningCharacter = PlayerCharacter;
+	HealthComponent = CharacterHealth;
 
-	// Cast to RunnerCharacter
-	OwningCharacter = Cast<ARunnerCharacter>(ControlledPawn);
-	if (!OwningCharacter)
-	{
-		UE_LOG(LogSideRunner, Warning, TEXT("HealthBarWidget: Pawn is not a RunnerCharacter"));
-		return false;
-	}
+	// Bind to health component delegates
+	HealthComponent->OnHealthChanged.AddUniqueDynamic(this, &UHealthBarWidget::OnHealthChanged);
+	HealthComponent->OnTakeDamage.AddUniqueDynamic(this, &UHealthBarWidget::OnTakeDamage);
+	HealthComponent->OnPlayerDeath.AddUniqueDynamic(this, &UHealthBarWidget::OnPlayerDeath);
 
-	// Get the health component
-	HealthComponent = OwningCharacter->HealthComponent;
+	return true;
+}
+
+void UHealthBarWidget::SyncFromHealthComponent()
+{
 	if (!HealthComponent)
 	{
-		UE_LOG(LogSideRunner, Error, TEXT("HealthBarWidget: RunnerCharacter has no HealthComponent!"));
-		return false;
+		return;
 	}
 
-	// Bind to health component delegates
-	HealthComponent->OnHealthChanged.AddDynamic(this, &UHealthBarWidget::OnHealthChanged);
-	HealthComponent->OnTakeDamage.AddDynamic(this, &UHealthBarWidget::OnTakeDamage);
-	HealthComponent->OnPlayerDeath.AddDynamic(this, &UHealthBarWidget::OnPlayerDeath);
-
-	// Initialize state from current health values
 	CurrentHealth = HealthComponent->CurrentHealth;
 	MaxHealth = HealthComponent->MaxHealth;
 	HitCount = HealthComponent->GetTotalHitsTaken();
-
-	return true;
 }
 
 void UHealthBarWidget::UnbindFromHealthComponent()
@@ -306,14 +300,6 @@ void UHealthBarWidget::UnbindFromHealthComponent()
 
 	HealthComponent = nullptr;
 	OwningCharacter = nullptr;
-
-	// Clear the retry timer so NativeTick can re-trigger binding after respawn.
-	// Without this, the valid-but-stale timer handle blocks all subsequent retry attempts.
-	if (BindRetryTimerHandle.IsValid())
-	{
-		GetWorld()->GetTimerManager().ClearTimer(BindRetryTimerHandle);
-		BindRetryTimerHandle.Invalidate();
-	}
 }
 
 bool UHealthBarWidget::ValidateWidgetBindings() const
@@ -11,6 +11,7 @@
 class UProgressBar;
 class UTextBlock;
 class ARunnerCharacter;
+class USideRunnerGameInstance;
 
 /**
  * Performance-optimized C++ UMG widget for displaying player health.
@@ -20,7 +21,8 @@ class ARunnerCharacter;
  * 1. Create UMG Widget Blueprint with parent class UHealthBarWidget
  * 2. Add ProgressBar named "HealthProgressBar"
  * 3. Add TextBlock named "HitCounterText" (optional)
- * 4. Widget auto-binds to health component on construct
+ * 4. Widget binds when the player character registers with the game instance
+ *    (OnPlayerCharacterReady) - immediately on construct if it already has, and again on respawn
  */
 UCLASS()
 class SIDERUNNER_API UHealthBarWidget : public UUserWidget
@@ -65,7 +67,7 @@ public:
 protected:
 	// PERFORMANCE: UWidget overrides
 
-	/** Called when widget is constructed - auto-binds to health component */
+	/** Called when widget is constructed - subscribes to player registration */
 	virtual void NativeConstruct() override;
 
 	/** Called when widget is destroyed - unbinds from health component */
@@ -88,6 +90,10 @@ protected:
 	UFUNCTION()
 	void OnPlayerDeath(int32 TotalHitsTaken);
 
+	/** Callback when the player character finishes BeginPlay or respawns - (re)binds and refreshes */
+	UFUNCTION()
+	void OnPlayerCharacterReady(ARunnerCharacter* PlayerCharacter);
+
 private:
 	// PERFORMANCE: Internal state tracking
 
@@ -108,8 +114,9 @@ private:
 	UPROPERTY()
 	ARunnerCharacter* OwningCharacter;
 
-	/** Timer handle for retrying health component binding */
-	FTimerHandle BindRetryTimerHandle;
+	/** Game instance that broadcasts player registration */
+	UPROPERTY()
+	USideRunnerGameInstance* CachedGameInstance;
 
 	// PERFORMANCE: Helper functions
 
@@ -125,11 +132,11 @@ private:
 	/** Gets the health percentage (0.0 - 1.0) */
 	float GetHealthPercent() const;
 
-	/** Attempts to find and bind to the player's health component */
-	bool BindToHealthComponent();
+	/** Binds to the character's health component delegates */
+	bool BindToHealthComponent(ARunnerCharacter* PlayerCharacter);
 
-	/** Retry function called by timer to bind to health component */
-	void TryBindToHealthComponent();
+	/** Copies health and hit count from the bound health component */
+	void SyncFromHealthComponent();
 
 	/** Unbinds from health component delegates */
 	void UnbindFromHealthComponent();
@@ -0,0 +1,161 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class ABaseLevel;
+
+/**
+ * Bookkeeping for one live level chunk, recorded at spawn time.
+ */
+struct FLevelChunkRecord
+{
+    /** The spawned level actor (weak: the world owns it) */
+    TWeakObjectPtr<ABaseLevel> Level;
+
+    /** World Y where the chunk begins */
+    float StartY = 0.0f;
+
+    /** World Y where the chunk ends (start of the next chunk) */
+    float EndY = 0.0f;
+
+    /** Full world position the next chunk spawns at (EndLocation.Y == EndY) */
+    FVector EndLocation = FVector::ZeroVector;
+
+    /** Run seed the chunk was generated from (procedural only) */
+    int32 Seed = 0;
+
+    /** Chunk index within the run, or INDEX_NONE for handcrafted levels */
+    int32 ChunkIndex = INDEX_NONE;
+
+    /** Difficulty the chunk was generated at */
+    float Difficulty = 1.0f;
+
+    /** Level class to respawn when replaying a handcrafted chunk */
+    UClass* LevelClass = nullptr;
+
+    /** Coin registry key of a handcrafted chunk (procedural chunks use ChunkIndex) */
+    int32 CoinRegistryKey = INDEX_NONE;
+
+    /** Number of generated actors owned by the chunk's level */
+    int32 NumActors = 0;
+
+    /** True if the chunk was generated procedurally (can be regenerated from Seed/ChunkIndex) */
+    bool IsProcedural() const { return ChunkIndex != INDEX_NONE; }
+};
+
+/**
+ * Fixed-capacity ring of live level chunks, ordered oldest (front) to newest (back).
+ *
+ * PERFORMANCE: O(1) push/pop at either end with no element shifting, and amortized O(1)
+ * "chunk under Y" lookup via a cursor that follows the player forward.
+ */
+class FLevelChunkRing
+{
+public:
+    /** Empties the ring and sets its capacity. */
+    void Reset(int32 InCapacity)
+    {
+        Slots.Reset();
+        Slots.SetNum(FMath::Max(1, InCapacity));
+        Head = 0;
+        Count = 0;
+        Cursor = 0;
+    }
+
+    /** Removes all records, keeping capacity. */
+    void Empty()
+    {
+        for (FLevelChunkRecord& Slot : Slots)
+        {
+            Slot = FLevelChunkRecord();
+        }
+        Head = 0;
+        Count = 0;
+        Cursor = 0;
+    }
+
+    int32 Num() const { return Count; }
+    int32 Capacity() const { return Slots.Num(); }
+    bool IsEmpty() const { return Count == 0; }
+    bool IsFull() const { return Count == Slots.Num(); }
+
+    /** Record by logical index: 0 = oldest, Num()-1 = newest. */
+    FLevelChunkRecord& operator[](int32 Index)
+    {
+        check(Index >= 0 && Index < Count);
+        return Slots[(Head + Index) % Slots.Num()];
+    }
+
+    const FLevelChunkRecord& operator[](int32 Index) const
+    {
+        check(Index >= 0 && Index < Count);
+        return Slots[(Head + Index) % Slots.Num()];
+    }
+
+    FLevelChunkRecord& Front() { return (*this)[0]; }
+    FLevelChunkRecord& Back() { return (*this)[Count - 1]; }
+    const FLevelChunkRecord& Front() const { return (*this)[0]; }
+    const FLevelChunkRecord& Back() const { return (*this)[Count - 1]; }
+
+    /** Appends a record as the newest chunk. The ring must not be full. */
+    void PushBack(const FLevelChunkRecord& Record)
+    {
+        check(!IsFull());
+        Slots[(Head + Count) % Slots.Num()] = Record;
+        Count++;
+    }
+
+    /** Removes and returns the oldest chunk. The ring must not be empty. */
+    FLevelChunkRecord PopFront()
+    {
+        check(!IsEmpty());
+        FLevelChunkRecord Record = MoveTemp(Slots[Head]);
+        Slots[Head] = FLevelChunkRecord();
+        Head = (Head + 1) % Slots.Num();
+        Count--;
+        Cursor = FMath::Max(0, Cursor - 1);
+        return Record;
+    }
+
+    /**
+     * Finds the chunk whose [StartY, EndY) span contains Y.
+     *
+     * @param Y - World Y position to look up
+     * @return Logical index of the containing chunk, or INDEX_NONE if Y is outside every chunk
+     */
+    int32 FindIndexAtY(float Y) const
+    {
+        if (Count == 0)
+        {
+            return INDEX_NONE;
+        }
+
+        // Walk from the last hit — the player moves at most a chunk or so per query
+        int32 Index = FMath::Clamp(Cursor, 0, Count - 1);
+        while (Index > 0 && Y < (*this)[Index].StartY)
+        {
+            Index--;
+        }
+        while (Index < Count - 1 && Y >= (*this)[Index].EndY)
+        {
+            Index++;
+        }
+
+        const FLevelChunkRecord& Record = (*this)[Index];
+        if (Y < Record.StartY || Y >= Record.EndY)
+        {
+            return INDEX_NONE;
+        }
+
+        Cursor = Index;
+        return Index;
+    }
+
+private:
+    TArray<FLevelChunkRecord> Slots;
+    int32 Head = 0;
+    int32 Count = 0;
+
+    /** Logical index of the last FindIndexAtY hit */
+    mutable int32 Cursor = 0;
+};
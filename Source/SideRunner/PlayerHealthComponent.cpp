@@ -1,4 +1,5 @@
 #include "PlayerHealthComponent.h"
+#include "StatusEffectComponent.h"
 #include "SideRunner.h"
 #include "SideRunner/RunnerCharacter.h"
 #include "GameFramework/NavMovementComponent.h"
@@ -22,6 +23,15 @@ void UPlayerHealthComponent::BeginPlay()
     Super::BeginPlay();
     UE_LOG(LogSideRunner, Log, TEXT("[Health] Component spawned on %s"), *GetOwner()->GetName());
 
+    // Invincibility lives on the owner's status effects; add them if the owner has none
+    StatusEffects = GetOwner()->FindComponentByClass<UStatusEffectComponent>();
+    if (!StatusEffects)
+    {
+        StatusEffects = NewObject<UStatusEffectComponent>(GetOwner(), TEXT("StatusEffects"));
+        StatusEffects->RegisterComponent();
+    }
+    StatusEffects->OnEffectExpired.AddDynamic(this, &UPlayerHealthComponent::HandleStatusEffectExpired);
+
     // Auto-initialize so the component is always ready before any Blueprint BeginPlay runs.
     // This guarantees TakeDamage(), delegate binding, etc. all work from the first frame.
     // Blueprint can still call InitHealth() to re-initialize if needed (e.g., after respawn).
@@ -30,10 +40,9 @@ void UPlayerHealthComponent::BeginPlay()
 
 void UPlayerHealthComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    // Clear any active timers
-    if (UWorld* World = GetWorld())
+    if (IsValid(StatusEffects))
     {
-        World->GetTimerManager().ClearTimer(InvincibilityTimerHandle);
+        StatusEffects->OnEffectExpired.RemoveAll(this);
     }
     Super::EndPlay(EndPlayReason);
 }
@@ -77,11 +86,12 @@ float UPlayerHealthComponent::TakeDamage(float DamageAmount, EDamageType DamageT
     }
 
     // ── Invincibility guard ────────────────────────────────────────────────
-    if (bInvincible || IsDead())
+    const bool bInvincibleNow = IsInvincible();
+    if (bInvincibleNow || IsDead())
     {
         UE_LOG(LogSideRunner, Verbose,
             TEXT("[Health] TakeDamage(%.1f) ignored on %s — Invincible=%d, Dead=%d"),
-            DamageAmount, *GetOwner()->GetName(), bInvincible, IsDead());
+            DamageAmount, *GetOwner()->GetName(), bInvincibleNow, IsDead());
         return 0.0f;
     }
 
@@ -132,12 +142,10 @@ void UPlayerHealthComponent::ResetHealth()
     bInitialized = true;
     TotalHitsTaken = 0;
 
-    // Clear invincibility state and timer
-    bInvincible = false;
-    InvincibilityTimer = 0.0f;
-    if (UWorld* World = GetWorld())
+    // Clear invincibility without firing OnInvincibilityEnded
+    if (StatusEffects)
     {
-        World->GetTimerManager().ClearTimer(InvincibilityTimerHandle);
+        StatusEffects->RemoveEffect(StatusEffectNames::Invincibility, false);
     }
 
     OnHealthInitialized.Broadcast();
@@ -204,50 +212,37 @@ void UPlayerHealthComponent::TriggerInvincibility(float Duration)
 {
     if (Duration <= 0.0f || IsDead()) return;
 
-    UWorld* World = GetWorld();
-    if (!World) return;
+    if (!StatusEffects) return;
 
-    bInvincible = true;
-    InvincibilityTimer = Duration;
+    // Re-triggering restarts the window, as before (ApplyEffect alone would only extend it)
+    StatusEffects->RemoveEffect(StatusEffectNames::Invincibility, false);
+    StatusEffects->ApplyEffect(StatusEffectNames::Invincibility, Duration);
 
     UE_LOG(LogSideRunner, Log,
         TEXT("[Health] Invincibility triggered on %s for %.1fs"),
         *GetOwner()->GetName(), Duration);
-
-    FTimerManager& TM = World->GetTimerManager();
-    TM.ClearTimer(InvincibilityTimerHandle);
-    TM.SetTimer(
-        InvincibilityTimerHandle,
-        this,
-        &UPlayerHealthComponent::TickInvincibility,
-        INVINCIBILITY_TICK_RATE,
-        true
-    );
 }
 
-void UPlayerHealthComponent::TickInvincibility()
+void UPlayerHealthComponent::HandleStatusEffectExpired(FName Effect)
 {
-    if (!bInvincible) return;
-
-    InvincibilityTimer -= INVINCIBILITY_TICK_RATE;
-    if (InvincibilityTimer <= 0.0f)
+    if (Effect != StatusEffectNames::Invincibility)
     {
-        bInvincible = false;
-        InvincibilityTimer = 0.0f;
-
-        UWorld* World = GetWorld();
-        if (World)
-        {
-            World->GetTimerManager().ClearTimer(InvincibilityTimerHandle);
-        }
-
-        UE_LOG(LogSideRunner, Log,
-            TEXT("[Health] Invincibility ended on %s"),
-            *GetOwner()->GetName());
+        return;
     }
+
+    UE_LOG(LogSideRunner, Log,
+        TEXT("[Health] Invincibility ended on %s"),
+        *GetOwner()->GetName());
+
+    OnInvincibilityEnded.Broadcast();
 }
 
 bool UPlayerHealthComponent::IsInvincible() const
 {
-    return bInvincible;
+    return StatusEffects && StatusEffects->HasEffect(StatusEffectNames::Invincibility);
+}
+
+float UPlayerHealthComponent::GetInvincibilityRemaining() const
+{
+    return StatusEffects ? StatusEffects->GetRemainingTime(StatusEffectNames::Invincibility) : 0.0f;
 }
@@ -17,6 +17,7 @@ enum class EDamageType : uint8
 class UTextBlock;
 class UProgressBar;
 class AActor;
+class UStatusEffectComponent;
 
 /**
  * Delegate signatures for health component events.
@@ -28,6 +29,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnDeath);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FLegacyOnTakeDamage, int32, DamageAmount, EDamageType, DamageType);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FLegacyOnPlayerDeath, int32, TotalHitsTaken);
 DECLARE_MULTICAST_DELEGATE(FOnHealthInitialized);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnInvincibilityEnded);
 
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
 class SIDERUNNER_API UPlayerHealthComponent : public UActorComponent
@@ -63,6 +65,10 @@ public:
 
     FOnHealthInitialized OnHealthInitialized;
 
+    /** Fired once when invincibility runs out (not when cleared by ResetHealth). */
+    UPROPERTY(BlueprintAssignable, Category = "Health|Events")
+    FOnInvincibilityEnded OnInvincibilityEnded;
+
     UFUNCTION(BlueprintCallable, Category = "Health")
     float TakeDamage(float DamageAmount, EDamageType DamageType);
 
@@ -110,12 +116,16 @@ public:
     void SetInvulnerabilityTime(float Duration) { TriggerInvincibility(Duration); }
 
     UFUNCTION(BlueprintPure, Category = "Health|Invincibility")
-    bool IsInvulnerable() const { return bInvincible; }
+    bool IsInvulnerable() const { return IsInvincible(); }
 
     // ── New API ───────────────────────────────────────────────────────────
     UFUNCTION(BlueprintPure, Category = "Health|Invincibility")
     bool IsInvincible() const;
 
+    /** Seconds of invincibility left (0 when not invincible). */
+    UFUNCTION(BlueprintPure, Category = "Health|Invincibility")
+    float GetInvincibilityRemaining() const;
+
 protected:
     virtual void BeginPlay() override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
@@ -123,19 +133,18 @@ protected:
 private:
     bool bInitialized = false;
     bool bDead = false;
-    bool bInvincible = false;
     int32 TotalHitsTaken = 0;
-    float InvincibilityTimer = 0.0f;
-
-    static constexpr float INVINCIBILITY_TICK_RATE = 0.05f;
 
-    FTimerHandle InvincibilityTimerHandle;
+    // PERFORMANCE: Invincibility is the owner's StatusEffects::Invincibility effect — an expiry
+    // timestamp checked on damage, expired by the shared status-effect timing wheel
+    UPROPERTY()
+    UStatusEffectComponent* StatusEffects = nullptr;
 
     UFUNCTION()
     void BroadcastHealthChange();
 
     UFUNCTION()
-    void TickInvincibility();
+    void HandleStatusEffectExpired(FName Effect);
 
     UFUNCTION()
     void TriggerDeath();
@@ -2,8 +2,15 @@
 #include "Engine/World.h"
 #include "Spikes.h"
 #include "CoinPickup.h"
+#include "CoinPoolSubsystem.h"
+#include "CoinField.h"
+#include "Components/StaticMeshComponent.h"
 #include "SimpleEnemy.h"
+#include "EnemyCharacter.h"
+#include "WallSpike.h"
+#include "BaseLevel.h"
 #include "SideRunner.h" // Custom log categories
+#include "Async/ParallelFor.h"
 
 UProceduralLevelBuilder::UProceduralLevelBuilder()
 {
@@ -16,6 +23,21 @@ UProceduralLevelBuilder::UProceduralLevelBuilder()
     MinGapSize = 100.0f;
     MaxGapSize = 350.0f;
     BasePlatformMeshSize = 100.0f;
+    MovingPlatformAmplitude = 150.0f;
+    MovingPlatformPeriod = 3.0f;
+
+    // Enemy config defaults
+    EnemyMinDifficulty = 6.0f;
+    MaxEnemyChancePerPlatform = 0.25f;
+
+    // Layout cache: a few hundred bytes per chunk, so this holds several hundred chunks
+    LayoutCacheMaxKB = 256;
+
+    // Flag toggles until BenchmarkChunkDormancy shows Bulk is cheaper for these chunks
+    DormancyMode = EChunkDormancyMode::PerActor;
+    CoinPrewarmCount = 32;
+    bUseProxyCoins = false;
+    ProxyCoinField = nullptr;
 
     // Physics constraints from RunnerCharacter constructor
     JumpZVelocity = 1000.0f;
@@ -25,6 +47,243 @@ UProceduralLevelBuilder::UProceduralLevelBuilder()
 
     // Compute jump distances
     CalculateJumpDistances();
+
+    // Default movement weights reproduce the original tiers:
+    // 1-3 static only, 4-6 adds UpDown/LeftRight, 7+ adds Circular/Zigzag
+    FMovementWeightBand EasyBand;
+    EasyBand.MinDifficulty = 1.0f;
+    EasyBand.Weights.Add(EMovementType::Static, 1.0f);
+
+    FMovementWeightBand MediumBand = EasyBand;
+    MediumBand.MinDifficulty = 4.0f;
+    MediumBand.Weights.Add(EMovementType::UpDown, 1.0f);
+    MediumBand.Weights.Add(EMovementType::LeftRight, 1.0f);
+
+    FMovementWeightBand HardBand = MediumBand;
+    HardBand.MinDifficulty = 7.0f;
+    HardBand.Weights.Add(EMovementType::Circular, 1.0f);
+    HardBand.Weights.Add(EMovementType::Zigzag, 1.0f);
+
+    MovementTypeWeightBands = { EasyBand, MediumBand, HardBand };
+
+    // Pattern library: off by default; ships one or two starter patterns per feature
+    GeneratorMode = EChunkGeneratorMode::RandomWalk;
+
+    const auto MakeElement = [](float GapBefore, float Width, float Height, bool bMoving = false,
+                                bool bObstacle = false, int32 Coins = 0, bool bCoinArc = false)
+    {
+        FFeaturePatternElement Element;
+        Element.GapBefore = GapBefore;
+        Element.Width = Width;
+        Element.Height = Height;
+        Element.bMoving = bMoving;
+        Element.bObstacle = bObstacle;
+        Element.Coins = Coins;
+        Element.bCoinArc = bCoinArc;
+        return Element;
+    };
+
+    const auto MakePattern = [](EProceduralFeature Feature, float MinDifficulty, float MaxDifficulty,
+                                TArray<FFeaturePatternElement> Elements)
+    {
+        FFeaturePattern Pattern;
+        Pattern.Feature = Feature;
+        Pattern.MinDifficulty = MinDifficulty;
+        Pattern.MaxDifficulty = MaxDifficulty;
+        Pattern.Elements = MoveTemp(Elements);
+        return Pattern;
+    };
+
+    FeaturePatterns = {
+        // Stepping stones: gentle height changes
+        MakePattern(EProceduralFeature::StaticPlatform, 1.0f, 10.0f, {
+            MakeElement(150.0f, 400.0f, 0.0f),
+            MakeElement(150.0f, 300.0f, 50.0f),
+            MakeElement(150.0f, 300.0f, 0.0f, false, false, 1) }),
+        // Spike steps: climb over two hazards
+        MakePattern(EProceduralFeature::StaticPlatform, 5.0f, 10.0f, {
+            MakeElement(180.0f, 300.0f, 0.0f),
+            MakeElement(180.0f, 300.0f, 100.0f, false, true),
+            MakeElement(180.0f, 300.0f, 0.0f, false, true) }),
+        // Coin runway: wide, safe and rewarding
+        MakePattern(EProceduralFeature::CoinRun, 1.0f, 10.0f, {
+            MakeElement(150.0f, 500.0f, 0.0f, false, false, 3),
+            MakeElement(120.0f, 400.0f, 0.0f, false, false, 3) }),
+        // Long jumps with coin arcs over the gaps
+        MakePattern(EProceduralFeature::GapChallenge, 3.0f, 10.0f, {
+            MakeElement(200.0f, 250.0f, 0.0f),
+            MakeElement(320.0f, 200.0f, 80.0f, false, false, 0, true),
+            MakeElement(340.0f, 250.0f, 0.0f, false, true, 0, true) }),
+        // Ferry: one moving platform between two islands
+        MakePattern(EProceduralFeature::MovingPlatform, 4.0f, 10.0f, {
+            MakeElement(200.0f, 300.0f, 0.0f),
+            MakeElement(250.0f, 250.0f, 0.0f, true),
+            MakeElement(250.0f, 300.0f, 0.0f, false, false, 1) }),
+        // Moving gauntlet: back-to-back moving platforms into a guarded landing
+        MakePattern(EProceduralFeature::MovingPlatform, 7.0f, 10.0f, {
+            MakeElement(200.0f, 250.0f, 0.0f),
+            MakeElement(280.0f, 200.0f, 50.0f, true, false, 1),
+            MakeElement(280.0f, 200.0f, 0.0f, true),
+            MakeElement(280.0f, 250.0f, 0.0f, false, true) })
+    };
+}
+
+void UProceduralLevelBuilder::OnRegister()
+{
+    Super::OnRegister();
+
+    // Blueprint defaults are applied by now — bake tables before any generation
+    RebuildSamplingTables();
+}
+
+void UProceduralLevelBuilder::BeginPlay()
+{
+    Super::BeginPlay();
+
+    // Fill the world's coin pool before the first chunks need it
+    if (CoinClass && CoinPrewarmCount > 0 && !bUseProxyCoins)
+    {
+        if (UCoinPoolSubsystem* CoinPool = GetWorld()->GetSubsystem<UCoinPoolSubsystem>())
+        {
+            CoinPool->PrewarmCoins(CoinClass, CoinPrewarmCount, NAME_None, DormancyMode);
+        }
+    }
+}
+
+#if WITH_EDITOR
+void UProceduralLevelBuilder::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+    RebuildSamplingTables();
+}
+#endif
+
+// ======================================================================
+// Weighted Selection (Alias Tables)
+// ======================================================================
+
+void UProceduralLevelBuilder::BuildBandTables(const TArray<FSelectionWeightBand>& Bands, int32 NumOptions,
+    TArray<FAliasTable>& OutTables)
+{
+    OutTables.SetNum(NumDifficultyBands);
+
+    TArray<float, TInlineAllocator<16>> Weights;
+    for (int32 BandIndex = 0; BandIndex < NumDifficultyBands; ++BandIndex)
+    {
+        const float BandDifficulty = static_cast<float>(BandIndex + 1);
+
+        // Active band = highest MinDifficulty not above this difficulty
+        const FSelectionWeightBand* ActiveBand = nullptr;
+        for (const FSelectionWeightBand& Band : Bands)
+        {
+            if (Band.MinDifficulty <= BandDifficulty && (!ActiveBand || Band.MinDifficulty >= ActiveBand->MinDifficulty))
+            {
+                ActiveBand = &Band;
+            }
+        }
+
+        Weights.Reset();
+        for (int32 i = 0; i < NumOptions; ++i)
+        {
+            Weights.Add(ActiveBand && ActiveBand->Weights.IsValidIndex(i) ? ActiveBand->Weights[i] : 1.0f);
+        }
+
+        OutTables[BandIndex].Build(Weights);
+    }
+}
+
+void UProceduralLevelBuilder::RebuildSamplingTables()
+{
+    BuildBandTables(PlatformVariantWeightBands, PlatformVariants.Num(), PlatformVariantTables);
+    BuildBandTables(ObstacleClassWeightBands, ObstacleClasses.Num(), ObstacleClassTables);
+
+    // Movement weights are keyed by enum, so gather them into a dense array per band
+    constexpr int32 NumMovementTypes = static_cast<int32>(EMovementType::Zigzag) + 1;
+    MovementTypeTables.SetNum(NumDifficultyBands);
+
+    for (int32 BandIndex = 0; BandIndex < NumDifficultyBands; ++BandIndex)
+    {
+        const float BandDifficulty = static_cast<float>(BandIndex + 1);
+
+        const FMovementWeightBand* ActiveBand = nullptr;
+        for (const FMovementWeightBand& Band : MovementTypeWeightBands)
+        {
+            if (Band.MinDifficulty <= BandDifficulty && (!ActiveBand || Band.MinDifficulty >= ActiveBand->MinDifficulty))
+            {
+                ActiveBand = &Band;
+            }
+        }
+
+        TArray<float, TInlineAllocator<NumMovementTypes>> Weights;
+        Weights.SetNumZeroed(NumMovementTypes);
+        float TotalWeight = 0.0f;
+        if (ActiveBand)
+        {
+            for (const TPair<EMovementType, float>& Pair : ActiveBand->Weights)
+            {
+                Weights[static_cast<int32>(Pair.Key)] = Pair.Value;
+                TotalWeight += FMath::Max(0.0f, Pair.Value);
+            }
+        }
+
+        // No band or an empty band: all Static (the alias table would otherwise go uniform)
+        if (TotalWeight <= 0.0f)
+        {
+            Weights[static_cast<int32>(EMovementType::Static)] = 1.0f;
+        }
+
+        MovementTypeTables[BandIndex].Build(Weights);
+    }
+
+    PatternTable.Compile(FeaturePatterns, NumDifficultyBands);
+
+    // Fold the weights into the layout config hash so cached layouts invalidate on change
+    uint32 Hash = 0;
+    for (const FSelectionWeightBand& Band : PlatformVariantWeightBands)
+    {
+        Hash = HashCombine(Hash, GetTypeHash(Band.MinDifficulty));
+        for (const float Weight : Band.Weights)
+        {
+            Hash = HashCombine(Hash, GetTypeHash(Weight));
+        }
+    }
+    Hash = HashCombine(Hash, GetTypeHash(PlatformVariantWeightBands.Num()));
+    for (const FSelectionWeightBand& Band : ObstacleClassWeightBands)
+    {
+        Hash = HashCombine(Hash, GetTypeHash(Band.MinDifficulty));
+        for (const float Weight : Band.Weights)
+        {
+            Hash = HashCombine(Hash, GetTypeHash(Weight));
+        }
+    }
+    Hash = HashCombine(Hash, GetTypeHash(ObstacleClassWeightBands.Num()));
+    for (const FMovementWeightBand& Band : MovementTypeWeightBands)
+    {
+        Hash = HashCombine(Hash, GetTypeHash(Band.MinDifficulty));
+        for (const TPair<EMovementType, float>& Pair : Band.Weights)
+        {
+            Hash = HashCombine(Hash, HashCombine(GetTypeHash(static_cast<uint8>(Pair.Key)), GetTypeHash(Pair.Value)));
+        }
+    }
+    SamplingTablesHash = Hash;
+}
+
+int32 UProceduralLevelBuilder::SampleWeighted(const TArray<FAliasTable>& Tables, int32 NumOptions,
+    float Difficulty, uint32 RandomBits) const
+{
+    if (NumOptions <= 0)
+    {
+        return INDEX_NONE;
+    }
+
+    const int32 BandIndex = FMath::Clamp(FMath::FloorToInt(Difficulty), 1, NumDifficultyBands) - 1;
+    if (Tables.IsValidIndex(BandIndex) && Tables[BandIndex].Num() == NumOptions)
+    {
+        return Tables[BandIndex].Sample(RandomBits);
+    }
+
+    // Stale tables (options changed at runtime without a rebuild): uniform pick
+    return static_cast<int32>((static_cast<uint64>(RandomBits) * static_cast<uint64>(NumOptions)) >> 32);
 }
 
 // ======================================================================
@@ -63,14 +322,15 @@ void UProceduralLevelBuilder::CalculateJumpDistances()
 AActor* UProceduralLevelBuilder::GetOrSpawnActor(FActorPool<AActor>& Pool, TArray<AActor*>& GCRefs,
     UWorld* World, UClass* ActorClass, const FVector& SpawnLocation)
 {
-    AActor* Actor = Pool.GetActor();
+    // Keyed by class so the weighted class pick survives once pools warm up
+    AActor* Actor = ActorClass ? Pool.GetActor(ActorClass->GetFName()) : nullptr;
     if (Actor)
     {
-        GCRefs.Remove(Actor);
+        GCRefs.RemoveSwap(Actor);
+
+        // Move before waking: a bulk-dormant actor has no physics body yet, so this is a plain transform update
         Actor->SetActorLocation(SpawnLocation);
-        Actor->SetActorHiddenInGame(false);
-        Actor->SetActorEnableCollision(true);
-        Actor->SetActorTickEnabled(true);
+        ABaseLevel::SetActorsDormant(MakeArrayView(&Actor, 1), false, DormancyMode);
     }
     else if (ActorClass)
     {
@@ -87,7 +347,79 @@ AActor* UProceduralLevelBuilder::GetOrSpawnActor(FActorPool<AActor>& Pool, TArra
 // Core Generation
 // ======================================================================
 
-TArray<AActor*> UProceduralLevelBuilder::GenerateLevelContent(UWorld* World, float StartY, float Difficulty, int32 Seed)
+TArray<AActor*> UProceduralLevelBuilder::GenerateLevelContent(UWorld* World, float StartY, float Difficulty, int32 Seed, int32 ChunkIndex)
+{
+    if (!World)
+    {
+        UE_LOG(LogSideRunner, Error, TEXT("ProceduralLevelBuilder: World is null"));
+        return TArray<AActor*>();
+    }
+
+    const FChunkLayout Layout = GenerateChunkLayout(Difficulty, Seed, ChunkIndex);
+    return SpawnChunkLayout(World, Layout, StartY);
+}
+
+FChunkLayout UProceduralLevelBuilder::GenerateChunkLayout(float Difficulty, int32 Seed, int32 ChunkIndex) const
+{
+    FChunkLayout Layout;
+    Layout.Seed = Seed;
+    Layout.ChunkIndex = ChunkIndex;
+
+    // Clamp difficulty to valid range
+    Layout.Difficulty = FMath::Clamp(Difficulty, 1.0f, 10.0f);
+
+    // Counter-based: each draw is keyed by (element, purpose), so phases don't consume
+    // from a shared sequence and changing one feature leaves the others untouched.
+    const FChunkRandom Random(Seed, ChunkIndex);
+
+    if (GeneratorMode == EChunkGeneratorMode::PatternLibrary && PatternTable.HasPatternsFor(Layout.Difficulty))
+    {
+        // Phases 1-3 as table expansion: patterns carry their own obstacle and coin slots
+        LayoutPatterns(Random, Layout);
+    }
+    else
+    {
+        // Phase 1: Lay out platforms (controlled random walk)
+        LayoutPlatforms(Random, Layout);
+
+        // Phase 2: Place obstacles on platforms
+        LayoutObstacles(Random, Layout);
+
+        // Phase 3: Place coins
+        LayoutCoins(Random, Layout);
+    }
+
+    // Rare wall spike event (either mode)
+    LayoutWallSpike(Random, Layout);
+
+    // Phase 4: Place enemies on platforms left free by obstacles
+    LayoutEnemies(Random, Layout);
+
+    return Layout;
+}
+
+TArray<FChunkLayout> UProceduralLevelBuilder::GenerateChunkLayoutRange(int32 Seed, int32 FirstChunkIndex,
+    const TArray<float>& ChunkDifficulties) const
+{
+    TArray<FChunkLayout> Layouts;
+    Layouts.SetNum(ChunkDifficulties.Num());
+
+    // PERFORMANCE: Layouts are pure functions of (seed, chunk, difficulty), so each chunk is an
+    // independent task. Each worker writes only its own pre-sized slot — no locking needed.
+    ParallelFor(ChunkDifficulties.Num(), [this, Seed, FirstChunkIndex, &ChunkDifficulties, &Layouts](int32 Index)
+    {
+        Layouts[Index] = GenerateChunkLayout(QuantizeDifficulty(ChunkDifficulties[Index]), Seed, FirstChunkIndex + Index);
+    });
+
+#if UE_BUILD_DEVELOPMENT
+    UE_LOG(LogSideRunner, Log, TEXT("ProceduralLevelBuilder: Generated %d chunk layouts in parallel (Seed=%d, Chunks=%d..%d)"),
+           Layouts.Num(), Seed, FirstChunkIndex, FirstChunkIndex + Layouts.Num() - 1);
+#endif
+
+    return Layouts;
+}
+
+TArray<AActor*> UProceduralLevelBuilder::SpawnChunkLayout(UWorld* World, const FChunkLayout& Layout, float StartY)
 {
     TArray<AActor*> SpawnedActors;
 
@@ -97,49 +429,286 @@ TArray<AActor*> UProceduralLevelBuilder::GenerateLevelContent(UWorld* World, flo
         return SpawnedActors;
     }
 
-    // Clamp difficulty to valid range
-    Difficulty = FMath::Clamp(Difficulty, 1.0f, 10.0f);
+    SpawnedActors.Reserve(Layout.Platforms.Num() + Layout.Obstacles.Num() + Layout.Enemies.Num() + Layout.Coins.Num() + 1);
+
+    // Platforms (try pool first, then spawn new)
+    for (const FPlatformPlacement& Placement : Layout.Platforms)
+    {
+        TSubclassOf<AActor> SpawnClass = PlatformClass;
+        if (PlatformVariants.IsValidIndex(Placement.VariantIndex) && PlatformVariants[Placement.VariantIndex])
+        {
+            SpawnClass = PlatformVariants[Placement.VariantIndex];
+        }
+
+        const FVector PlatformLocation(0.0f, StartY + Placement.YPosition, Placement.ZPosition);
+        AActor* Platform = GetOrSpawnActor(PlatformPool, PlatformPoolGCRefs, World, SpawnClass, PlatformLocation);
+
+        if (Platform)
+        {
+            // Scale platform to desired width
+            FVector CurrentScale = Platform->GetActorScale3D();
+            CurrentScale.Y = Placement.Width / BasePlatformMeshSize;
+            Platform->SetActorScale3D(CurrentScale);
+
+            // Moving platforms join the batched motion set instead of ticking themselves
+            if (Placement.bIsMoving && Placement.MoveAmplitude > 0.0f && Placement.MovePeriod > 0.0f)
+            {
+                if (USceneComponent* Root = Platform->GetRootComponent())
+                {
+                    Root->SetMobility(EComponentMobility::Movable);
+                }
+
+                FMovingPlatformMotion& Motion = MovingPlatformMotions.AddDefaulted_GetRef();
+                Motion.BaseLocation = PlatformLocation;
+                Motion.Amplitude = Placement.MoveAmplitude;
+                Motion.AngularFrequency = UE_TWO_PI / Placement.MovePeriod;
+                Motion.Phase = Placement.MovePhase;
+                MovingPlatformActors.Add(Platform);
+            }
+
+            SpawnedActors.Add(Platform);
+        }
+    }
+
+    // Obstacles
+    for (const FObstaclePlacement& Placement : Layout.Obstacles)
+    {
+        if (!ObstacleClasses.IsValidIndex(Placement.ClassIndex) || !ObstacleClasses[Placement.ClassIndex])
+        {
+            continue;
+        }
+
+        const FVector SpawnLocation(0.0f, StartY + Placement.YPosition, Placement.ZPosition);
+        AActor* Obstacle = GetOrSpawnActor(ObstaclePool, ObstaclePoolGCRefs, World,
+            ObstacleClasses[Placement.ClassIndex], SpawnLocation);
+
+        if (Obstacle)
+        {
+            // Configure movement type based on difficulty
+            if (ASpikes* Spike = Cast<ASpikes>(Obstacle))
+            {
+                Spike->MovementType = static_cast<EMovementType>(Placement.MovementType);
+
+                // Enable movement for non-static types
+                Spike->bIsMoving = (Spike->MovementType != EMovementType::Static);
+            }
+
+            SpawnedActors.Add(Obstacle);
+        }
+    }
+
+    // Enemies (pooled; patrol origin and state are reset at every placement)
+    if (EnemyClass)
+    {
+        for (const FEnemyPlacement& Placement : Layout.Enemies)
+        {
+            const FVector SpawnLocation(0.0f, StartY + Placement.YPosition, Placement.ZPosition);
+            AActor* Enemy = GetOrSpawnActor(EnemyPool, EnemyPoolGCRefs, World, EnemyClass, SpawnLocation);
+
+            if (ASimpleEnemy* SimpleEnemy = Cast<ASimpleEnemy>(Enemy))
+            {
+                SimpleEnemy->ResetForReuse(Placement.PatrolDistance);
+            }
+            else if (AEnemyCharacter* EnemyCharacter = Cast<AEnemyCharacter>(Enemy))
+            {
+                EnemyCharacter->ResetForReuse(Placement.PatrolDistance);
+            }
 
-    FRandomStream RandomStream(Seed);
+            if (Enemy)
+            {
+                SpawnedActors.Add(Enemy);
+            }
+        }
+    }
 
-    // Phase 1: Generate platforms (controlled random walk)
-    TArray<FPlatformPlacement> Placements;
-    GeneratePlatforms(World, StartY, Difficulty, RandomStream, SpawnedActors, Placements);
+    // Wall spike (pooled; target, timers and chase audio are reset at every placement)
+    if (Layout.bHasWallSpike && WallSpikeClass)
+    {
+        AActor* WallSpike = GetOrSpawnActor(WallSpikePool, WallSpikePoolGCRefs, World, WallSpikeClass,
+            FVector(0.0f, StartY + Layout.WallSpikeLocation.X, Layout.WallSpikeLocation.Y));
 
-    // Phase 2: Place obstacles on platforms
-    GenerateObstacles(World, Difficulty, RandomStream, Placements, SpawnedActors);
+        if (AWallSpike* Spike = Cast<AWallSpike>(WallSpike))
+        {
+            Spike->ResetForReuse();
+        }
 
-    // Phase 2: Place coins
-    GenerateCoins(World, Difficulty, RandomStream, Placements, SpawnedActors);
+        if (WallSpike)
+        {
+            SpawnedActors.Add(WallSpike);
+        }
+    }
+
+    // Coins (world coin pool; the chunk releases them, so collected coins just stay hidden)
+    // (Proxy coins are added and registered separately through SpawnProxyCoins.)
+    UCoinPoolSubsystem* CoinPool = World->GetSubsystem<UCoinPoolSubsystem>();
+    if (CoinPool && !(bUseProxyCoins && CoinClass))
+    {
+        int32 NumCoins = 0;
+        if (CoinClass)
+        {
+            for (const FVector2D& CoinPosition : Layout.Coins)
+            {
+                const FVector CoinLocation(0.0f, StartY + CoinPosition.X, CoinPosition.Y);
+                ACoinPickup* Coin = CoinPool->AcquireCoin(CoinClass, FTransform(CoinLocation), NAME_None, DormancyMode, true);
+
+                if (Coin)
+                {
+                    SpawnedActors.Add(Coin);
+                    NumCoins++;
+                }
+            }
+        }
+
+        // PERFORMANCE: Coin totals are kept incrementally per chunk, so nothing scans the world for coins
+        CoinPool->RegisterChunkCoins(Layout.ChunkIndex, NumCoins);
+    }
 
 #if UE_BUILD_DEVELOPMENT
-    UE_LOG(LogSideRunner, Log, TEXT("ProceduralLevelBuilder: Generated %d actors (Difficulty=%.1f, Seed=%d, StartY=%.0f)"),
-           SpawnedActors.Num(), Difficulty, Seed, StartY);
+    UE_LOG(LogSideRunner, Log, TEXT("ProceduralLevelBuilder: Generated %d actors (Difficulty=%.1f, Seed=%d, Chunk=%d, StartY=%.0f)"),
+           SpawnedActors.Num(), Layout.Difficulty, Layout.Seed, Layout.ChunkIndex, StartY);
 #endif
 
     return SpawnedActors;
 }
 
 // ======================================================================
-// Platform Generation (Controlled Random Walk)
+// Layout Cache
+// ======================================================================
+
+FChunkLayout UProceduralLevelBuilder::GetOrGenerateChunkLayout(float Difficulty, int32 Seed, int32 ChunkIndex)
+{
+    LayoutCache.SetMaxBytes(static_cast<SIZE_T>(LayoutCacheMaxKB) * 1024);
+
+    // Quantize so the cache key fully determines the generated layout
+    const FChunkLayoutKey Key = MakeLayoutKey(Seed, ChunkIndex, Difficulty, ComputeLayoutConfigHash());
+    if (const FChunkLayout* Cached = LayoutCache.FindAndTouch(Key))
+    {
+        return *Cached;
+    }
+
+    const FChunkLayout Layout = GenerateChunkLayout(QuantizeDifficulty(Difficulty), Seed, ChunkIndex);
+    LayoutCache.Add(Key, Layout);
+    return Layout;
+}
+
+int32 UProceduralLevelBuilder::PrewarmLayoutCache(int32 Seed, int32 FirstChunkIndex, const TArray<float>& ChunkDifficulties)
+{
+    LayoutCache.SetMaxBytes(static_cast<SIZE_T>(LayoutCacheMaxKB) * 1024);
+
+    // Only generate what the cache is missing
+    const uint32 ConfigHash = ComputeLayoutConfigHash();
+    TArray<FChunkLayoutKey> MissingKeys;
+    TArray<float> MissingDifficulties;
+    for (int32 Index = 0; Index < ChunkDifficulties.Num(); ++Index)
+    {
+        const FChunkLayoutKey Key = MakeLayoutKey(Seed, FirstChunkIndex + Index, ChunkDifficulties[Index], ConfigHash);
+        if (!LayoutCache.Contains(Key))
+        {
+            MissingKeys.Add(Key);
+            MissingDifficulties.Add(QuantizeDifficulty(ChunkDifficulties[Index]));
+        }
+    }
+
+    // PERFORMANCE: Same per-slot parallel generation as GenerateChunkLayoutRange; the cache itself
+    // is not thread-safe, so inserts happen afterwards on this thread
+    TArray<FChunkLayout> Layouts;
+    Layouts.SetNum(MissingKeys.Num());
+    ParallelFor(MissingKeys.Num(), [this, &MissingKeys, &MissingDifficulties, &Layouts](int32 Index)
+    {
+        Layouts[Index] = GenerateChunkLayout(MissingDifficulties[Index], MissingKeys[Index].Seed, MissingKeys[Index].ChunkIndex);
+    });
+
+    for (int32 Index = 0; Index < Layouts.Num(); ++Index)
+    {
+        LayoutCache.Add(MissingKeys[Index], Layouts[Index]);
+    }
+
+#if UE_BUILD_DEVELOPMENT
+    UE_LOG(LogSideRunner, Log, TEXT("ProceduralLevelBuilder: Prewarmed %d of %d chunk layouts (Seed=%d, Chunks=%d..%d)"),
+           Layouts.Num(), ChunkDifficulties.Num(), Seed, FirstChunkIndex, FirstChunkIndex + ChunkDifficulties.Num() - 1);
+#endif
+
+    return Layouts.Num();
+}
+
+int32 UProceduralLevelBuilder::GetDifficultyBucket(float Difficulty)
+{
+    return FMath::RoundToInt(FMath::Clamp(Difficulty, 1.0f, 10.0f) * DifficultyBucketsPerLevel);
+}
+
+float UProceduralLevelBuilder::QuantizeDifficulty(float Difficulty)
+{
+    return static_cast<float>(GetDifficultyBucket(Difficulty)) / DifficultyBucketsPerLevel;
+}
+
+FChunkLayoutKey UProceduralLevelBuilder::MakeLayoutKey(int32 Seed, int32 ChunkIndex, float Difficulty, uint32 ConfigHash)
+{
+    FChunkLayoutKey Key;
+    Key.Seed = Seed;
+    Key.ChunkIndex = ChunkIndex;
+    Key.DifficultyBucket = GetDifficultyBucket(Difficulty);
+    Key.ConfigHash = ConfigHash;
+    return Key;
+}
+
+void UProceduralLevelBuilder::ClearLayoutCache()
+{
+    LayoutCache.Empty();
+}
+
+uint32 UProceduralLevelBuilder::ComputeLayoutConfigHash() const
+{
+    uint32 Hash = GetTypeHash(ChunkLength);
+    Hash = HashCombine(Hash, GetTypeHash(MinPlatformWidth));
+    Hash = HashCombine(Hash, GetTypeHash(MaxPlatformWidth));
+    Hash = HashCombine(Hash, GetTypeHash(MinGapSize));
+    Hash = HashCombine(Hash, GetTypeHash(MaxGapSize));
+    Hash = HashCombine(Hash, GetTypeHash(MovingPlatformAmplitude));
+    Hash = HashCombine(Hash, GetTypeHash(MovingPlatformPeriod));
+    Hash = HashCombine(Hash, GetTypeHash(MaxDoubleJumpDistance));
+    Hash = HashCombine(Hash, GetTypeHash(PlatformClass != nullptr));
+    Hash = HashCombine(Hash, GetTypeHash(PlatformVariants.Num()));
+    Hash = HashCombine(Hash, GetTypeHash(ObstacleClasses.Num()));
+    Hash = HashCombine(Hash, GetTypeHash(CoinClass != nullptr));
+    Hash = HashCombine(Hash, GetTypeHash(WallSpikeClass != nullptr));
+    Hash = HashCombine(Hash, GetTypeHash(EnemyClass != nullptr));
+    Hash = HashCombine(Hash, GetTypeHash(EnemyMinDifficulty));
+    Hash = HashCombine(Hash, GetTypeHash(MaxEnemyChancePerPlatform));
+    Hash = HashCombine(Hash, SamplingTablesHash);
+    Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(GeneratorMode)));
+    Hash = HashCombine(Hash, PatternTable.Hash);
+    return Hash;
+}
+
+// ======================================================================
+// Platform Layout (Controlled Random Walk)
 // ======================================================================
 
-void UProceduralLevelBuilder::GeneratePlatforms(UWorld* World, float StartY, float Difficulty,
-    FRandomStream& RandomStream, TArray<AActor*>& OutActors, TArray<FPlatformPlacement>& OutPlacements)
+void UProceduralLevelBuilder::LayoutPlatforms(const FChunkRandom& Random, FChunkLayout& Layout) const
 {
-    // Determine platform class to use
-    TSubclassOf<AActor> EffectivePlatformClass = PlatformClass;
-    if (!EffectivePlatformClass)
+    if (!PlatformClass)
     {
         UE_LOG(LogSideRunner, Warning, TEXT("ProceduralLevelBuilder: No PlatformClass set, skipping platform generation"));
         return;
     }
 
+    const float Difficulty = Layout.Difficulty;
     const float DifficultyAlpha = GetDifficultyAlpha(Difficulty);
-    float CurrentY = StartY;
-    const float EndY = StartY + ChunkLength;
+    float CurrentY = 0.0f;
 
-    while (CurrentY < EndY)
+    // Moving platform chance. Platform 0 never moves: it is the landing spot from the previous
+    // chunk, whose last gap could not account for its motion.
+    const float MovingChance = FMath::Lerp(0.05f, 0.4f, DifficultyAlpha);
+    const auto IsMovingAt = [&Random, MovingChance](int32 Index)
+    {
+        return Index > 0 && Random.FRand(Index, EChunkRandomPurpose::PlatformMoving) < MovingChance;
+    };
+
+    const float MaxJumpableGap = MaxDoubleJumpDistance * 0.9f;
+    const float MoveAmplitude = GetMovingPlatformAmplitude();
+    const float MovePeriod = FMath::Lerp(MovingPlatformPeriod, MovingPlatformPeriod * 0.6f, DifficultyAlpha);
+
+    for (int32 PlatformIndex = 0; CurrentY < ChunkLength; ++PlatformIndex)
     {
         FPlatformPlacement Placement;
 
@@ -147,234 +716,293 @@ void UProceduralLevelBuilder::GeneratePlatforms(UWorld* World, float StartY, flo
         Placement.Width = FMath::Lerp(MaxPlatformWidth, MinPlatformWidth, DifficultyAlpha);
 
         // Add slight random variation (±10%)
-        Placement.Width *= RandomStream.FRandRange(0.9f, 1.1f);
+        Placement.Width *= Random.FRandRange(PlatformIndex, EChunkRandomPurpose::PlatformWidth, 0.9f, 1.1f);
         Placement.Width = FMath::Clamp(Placement.Width, MinPlatformWidth, MaxPlatformWidth);
 
-        // Platform Y position
+        // Platform Y position (chunk-local)
         Placement.YPosition = CurrentY;
 
         // Height variation increases with difficulty
         const float MaxHeightVariation = FMath::Lerp(0.0f, 200.0f, DifficultyAlpha);
-        Placement.ZPosition = BaseGroundZ + RandomStream.FRandRange(-MaxHeightVariation * 0.3f, MaxHeightVariation);
+        Placement.ZPosition = BaseGroundZ + Random.FRandRange(PlatformIndex, EChunkRandomPurpose::PlatformHeight,
+            -MaxHeightVariation * 0.3f, MaxHeightVariation);
 
-        // Moving platform chance
-        const float MovingChance = FMath::Lerp(0.05f, 0.4f, DifficultyAlpha);
-        Placement.bIsMoving = RandomStream.FRand() < MovingChance;
+        // Moving platform: analytic oscillation along Y around its rest position
+        Placement.bIsMoving = IsMovingAt(PlatformIndex);
+        if (Placement.bIsMoving)
+        {
+            Placement.MoveAmplitude = MoveAmplitude;
+            Placement.MovePeriod = MovePeriod;
+            Placement.MovePhase = Random.FRandRange(PlatformIndex, EChunkRandomPurpose::PlatformMotionPhase, 0.0f, UE_TWO_PI);
+        }
 
         // Coin chance
         const float CoinChance = 0.3f + Difficulty * 0.05f;
-        Placement.bHasCollectible = RandomStream.FRand() < CoinChance;
+        Placement.bHasCollectible = Random.FRand(PlatformIndex, EChunkRandomPurpose::PlatformCollectible) < CoinChance;
 
         // Platform length (Y-axis depth)
-        Placement.Length = RandomStream.FRandRange(200.0f, 400.0f);
-
-        OutPlacements.Add(Placement);
+        Placement.Length = Random.FRandRange(PlatformIndex, EChunkRandomPurpose::PlatformLength, 200.0f, 400.0f);
 
         // Select platform variant for visual variety
-        TSubclassOf<AActor> SpawnClass = EffectivePlatformClass;
         if (PlatformVariants.Num() > 0)
         {
-            const int32 VariantIndex = RandomStream.RandRange(0, PlatformVariants.Num() - 1);
-            if (PlatformVariants[VariantIndex])
-            {
-                SpawnClass = PlatformVariants[VariantIndex];
-            }
+            Placement.VariantIndex = SampleWeighted(PlatformVariantTables, PlatformVariants.Num(), Difficulty,
+                Random.GetBits(PlatformIndex, EChunkRandomPurpose::PlatformVariant));
         }
 
-        // Spawn platform (try pool first, then spawn new)
-        const FVector PlatformLocation(0.0f, Placement.YPosition, Placement.ZPosition);
-        AActor* Platform = GetOrSpawnActor(PlatformPool, PlatformPoolGCRefs, World, SpawnClass, PlatformLocation);
-
-        if (Platform)
-        {
-            // Scale platform to desired width
-            FVector CurrentScale = Platform->GetActorScale3D();
-            CurrentScale.Y = Placement.Width / BasePlatformMeshSize;
-            Platform->SetActorScale3D(CurrentScale);
-
-            OutActors.Add(Platform);
-        }
+        Layout.Platforms.Add(Placement);
 
         // Gap to next platform
         float GapSize = FMath::Lerp(MinGapSize, MaxGapSize, DifficultyAlpha);
-        GapSize *= RandomStream.FRandRange(0.8f, 1.2f);
+        GapSize *= Random.FRandRange(PlatformIndex, EChunkRandomPurpose::GapSize, 0.8f, 1.2f);
 
-        // CRITICAL: Validate gap is jumpable — never exceed max double-jump distance
-        GapSize = FMath::Min(GapSize, MaxDoubleJumpDistance * 0.9f);
-        GapSize = FMath::Max(GapSize, MinGapSize);
+        // Motion bounds: the gap swings by this platform's and the next one's amplitude.
+        // Draws are counter-based, so the next platform's motion is known before it is laid out.
+        const float MotionSlack = Placement.MoveAmplitude + (IsMovingAt(PlatformIndex + 1) ? MoveAmplitude : 0.0f);
+
+        // CRITICAL: Validate gap is jumpable — the widest swing never exceeds max double-jump distance,
+        // and the narrowest never closes below the minimum gap
+        GapSize = FMath::Min(GapSize, MaxJumpableGap - MotionSlack);
+        GapSize = FMath::Max(GapSize, MinGapSize + MotionSlack);
 
         // Advance position past platform + gap
         CurrentY += Placement.Width + GapSize;
     }
 }
 
+float UProceduralLevelBuilder::GetMovingPlatformAmplitude() const
+{
+    // Both sides of a gap may move toward or away from each other, so four amplitudes
+    // must fit between the minimum gap and the jumpable maximum
+    const float MaxJumpableGap = MaxDoubleJumpDistance * 0.9f;
+    return FMath::Clamp(MovingPlatformAmplitude, 0.0f, FMath::Max(0.0f, (MaxJumpableGap - MinGapSize) * 0.25f));
+}
+
 // ======================================================================
-// Obstacle Generation
+// Pattern Layout (Table Expansion)
 // ======================================================================
 
-void UProceduralLevelBuilder::GenerateObstacles(UWorld* World, float Difficulty, FRandomStream& RandomStream,
-    const TArray<FPlatformPlacement>& Placements, TArray<AActor*>& OutActors)
+void UProceduralLevelBuilder::LayoutPatterns(const FChunkRandom& Random, FChunkLayout& Layout) const
 {
-    if (ObstacleClasses.Num() == 0)
+    if (!PlatformClass)
     {
-        return; // No obstacle classes configured
+        UE_LOG(LogSideRunner, Warning, TEXT("ProceduralLevelBuilder: No PlatformClass set, skipping platform generation"));
+        return;
     }
 
+    const float Difficulty = Layout.Difficulty;
     const float DifficultyAlpha = GetDifficultyAlpha(Difficulty);
-
-    // Obstacle density: 10% at difficulty 1, 60% at difficulty 10
-    const float ObstacleDensity = FMath::Lerp(0.1f, 0.6f, DifficultyAlpha);
-
-    for (int32 i = 0; i < Placements.Num(); ++i)
+    const float MaxJumpableGap = MaxDoubleJumpDistance * 0.9f;
+    const float MoveAmplitude = GetMovingPlatformAmplitude();
+    const float MovePeriod = FMath::Lerp(MovingPlatformPeriod, MovingPlatformPeriod * 0.6f, DifficultyAlpha);
+    const FFeaturePatternTable& Table = PatternTable;
+
+    float PreviousEndY = 0.0f;
+    float PreviousZ = BaseGroundZ;
+    float PreviousAmplitude = 0.0f;
+    bool bChunkFull = false;
+
+    // One draw per pattern slot; everything else is read straight from the tables
+    for (int32 PatternSlot = 0; !bChunkFull; ++PatternSlot)
     {
-        const FPlatformPlacement& Placement = Placements[i];
-
-        // Skip first platform (give player safe landing zone)
-        if (i == 0)
+        const int32 Pattern = Table.SamplePattern(Difficulty, Random.GetBits(PatternSlot, EChunkRandomPurpose::PatternSelect));
+        if (Pattern == INDEX_NONE)
         {
-            continue;
+            break;
         }
 
-        // Determine if this platform should have an obstacle
-        if (RandomStream.FRand() >= ObstacleDensity)
-        {
-            continue;
-        }
+        const int32 FirstElement = Table.PatternFirst[Pattern];
+        const int32 EndElement = FirstElement + Table.PatternNum[Pattern];
 
-        // Select obstacle class
-        const int32 ClassIndex = RandomStream.RandRange(0, ObstacleClasses.Num() - 1);
-        TSubclassOf<ASpikes> SpikeClass = ObstacleClasses[ClassIndex];
-        if (!SpikeClass)
+        for (int32 Element = FirstElement; Element < EndElement; ++Element)
         {
-            continue;
-        }
+            const int32 PlatformIndex = Layout.Platforms.Num();
+            const uint8 Flags = Table.Flags[Element];
 
-        // Spawn obstacle (try pool first, then spawn new)
-        FVector SpawnLocation(0.0f, Placement.YPosition + Placement.Width * 0.5f, Placement.ZPosition + 50.0f);
-        AActor* Obstacle = GetOrSpawnActor(ObstaclePool, ObstaclePoolGCRefs, World, SpikeClass, SpawnLocation);
+            FPlatformPlacement Placement;
+            Placement.Width = Table.Width[Element];
+            Placement.ZPosition = BaseGroundZ + Table.Height[Element];
+            Placement.bHasCollectible = Table.CoinSlots[Element] > 0;
 
-        if (Obstacle)
-        {
-            // Configure movement type based on difficulty
-            if (ASpikes* Spike = Cast<ASpikes>(Obstacle))
+            // Platform 0 is the landing spot from the previous chunk: keep it still and clear
+            Placement.bIsMoving = PlatformIndex > 0 && (Flags & FFeaturePatternTable::FlagMoving) != 0;
+            if (Placement.bIsMoving)
             {
-                const uint8 MovementTypeVal = SelectMovementTypeForDifficulty(Difficulty, RandomStream);
-                Spike->MovementType = static_cast<EMovementType>(MovementTypeVal);
+                Placement.MoveAmplitude = MoveAmplitude;
+                Placement.MovePeriod = MovePeriod;
+                Placement.MovePhase = Random.FRandRange(PlatformIndex, EChunkRandomPurpose::PlatformMotionPhase, 0.0f, UE_TWO_PI);
+            }
 
-                // Enable movement for non-static types
-                Spike->bIsMoving = (Spike->MovementType != EMovementType::Static);
+            // Authored gap, validated against jump physics and both neighbours' motion bounds
+            if (PlatformIndex > 0)
+            {
+                const float MotionSlack = PreviousAmplitude + Placement.MoveAmplitude;
+                float GapSize = FMath::Min(Table.GapBefore[Element], MaxJumpableGap - MotionSlack);
+                GapSize = FMath::Max(GapSize, MinGapSize + MotionSlack);
+                Placement.YPosition = PreviousEndY + GapSize;
             }
 
-            OutActors.Add(Obstacle);
-        }
-    }
+            // Patterns are cut at the chunk end, like the random walk
+            if (Placement.YPosition >= ChunkLength)
+            {
+                bChunkFull = true;
+                break;
+            }
 
-    // Wall spike: rare event at difficulty 5+ (5% chance per chunk)
-    if (Difficulty >= 5.0f && WallSpikeClass && RandomStream.FRand() < WallSpikeChancePerChunk)
-    {
-        // Spawn wall spike at a random Y position within the chunk
-        if (Placements.Num() > 2)
-        {
-            const int32 PlacementIndex = RandomStream.RandRange(1, Placements.Num() - 1);
-            const FPlatformPlacement& Placement = Placements[PlacementIndex];
+            if (PlatformVariants.Num() > 0)
+            {
+                Placement.VariantIndex = SampleWeighted(PlatformVariantTables, PlatformVariants.Num(), Difficulty,
+                    Random.GetBits(PlatformIndex, EChunkRandomPurpose::PlatformVariant));
+            }
 
-            FActorSpawnParameters SpawnParams;
-            SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+            Layout.Platforms.Add(Placement);
 
-            AActor* WallSpike = World->SpawnActor<AActor>(WallSpikeClass,
-                FVector(0.0f, Placement.YPosition - 500.0f, Placement.ZPosition),
-                FRotator::ZeroRotator, SpawnParams);
+            // Obstacle slot (never on platform 0; moving elements were stripped at compile time)
+            if ((Flags & FFeaturePatternTable::FlagObstacle) && PlatformIndex > 0 && ObstacleClasses.Num() > 0)
+            {
+                Layout.Obstacles.Add(MakeObstaclePlacement(Random, Difficulty, Placement, PlatformIndex));
+            }
 
-            if (WallSpike)
+            // Coin slots: evenly spaced above the platform, plus an optional arc over the gap before it.
+            // Coins are static, so moving platforms keep only the arc.
+            if (CoinClass)
             {
-                OutActors.Add(WallSpike);
+                const int32 NumCoins = Placement.bIsMoving ? 0 : Table.CoinSlots[Element];
+                for (int32 CoinIdx = 0; CoinIdx < NumCoins; ++CoinIdx)
+                {
+                    const float T = (CoinIdx + 1) / static_cast<float>(NumCoins + 1);
+                    Layout.Coins.Add(FVector2D(Placement.YPosition + Placement.Width * T,
+                                               Placement.ZPosition + CoinHeightOffset));
+                }
+
+                if ((Flags & FFeaturePatternTable::FlagCoinArc) && PlatformIndex > 0)
+                {
+                    AddCoinArc(Layout.Coins, PreviousEndY, Placement.YPosition,
+                               FMath::Max(PreviousZ, Placement.ZPosition) + 200.0f);
+                }
             }
+
+            PreviousEndY = Placement.YPosition + Placement.Width;
+            PreviousZ = Placement.ZPosition;
+            PreviousAmplitude = Placement.MoveAmplitude;
         }
     }
 }
 
 // ======================================================================
-// Movement Type Selection
+// Obstacle Layout
 // ======================================================================
 
-uint8 UProceduralLevelBuilder::SelectMovementTypeForDifficulty(float Difficulty, FRandomStream& RandomStream) const
+void UProceduralLevelBuilder::LayoutObstacles(const FChunkRandom& Random, FChunkLayout& Layout) const
 {
-    // Difficulty 1-3: Static only
-    if (Difficulty < 4.0f)
+    if (ObstacleClasses.Num() == 0)
     {
-        return static_cast<uint8>(EMovementType::Static);
+        return; // No obstacle classes configured
     }
 
-    // Difficulty 4-6: Static + UpDown/LeftRight
-    if (Difficulty < 7.0f)
+    const float Difficulty = Layout.Difficulty;
+    const TArray<FPlatformPlacement>& Placements = Layout.Platforms;
+    const float DifficultyAlpha = GetDifficultyAlpha(Difficulty);
+
+    // Obstacle density: 10% at difficulty 1, 60% at difficulty 10
+    const float ObstacleDensity = FMath::Lerp(0.1f, 0.6f, DifficultyAlpha);
+
+    // Skip first platform (give player safe landing zone)
+    for (int32 i = 1; i < Placements.Num(); ++i)
     {
-        const int32 Choice = RandomStream.RandRange(0, 2);
-        switch (Choice)
+        const FPlatformPlacement& Placement = Placements[i];
+
+        // Obstacles are static actors and would hang in the air over a moving platform
+        if (Placement.bIsMoving)
         {
-        case 0: return static_cast<uint8>(EMovementType::Static);
-        case 1: return static_cast<uint8>(EMovementType::UpDown);
-        case 2: return static_cast<uint8>(EMovementType::LeftRight);
-        default: return static_cast<uint8>(EMovementType::Static);
+            continue;
         }
+
+        // Determine if this platform should have an obstacle
+        if (Random.FRand(i, EChunkRandomPurpose::ObstacleChance) >= ObstacleDensity)
+        {
+            continue;
+        }
+
+        Layout.Obstacles.Add(MakeObstaclePlacement(Random, Difficulty, Placement, i));
+    }
+}
+
+FObstaclePlacement UProceduralLevelBuilder::MakeObstaclePlacement(const FChunkRandom& Random, float Difficulty,
+    const FPlatformPlacement& Placement, int32 PlatformIndex) const
+{
+    FObstaclePlacement Obstacle;
+    Obstacle.ClassIndex = SampleWeighted(ObstacleClassTables, ObstacleClasses.Num(), Difficulty,
+        Random.GetBits(PlatformIndex, EChunkRandomPurpose::ObstacleClass));
+    Obstacle.YPosition = Placement.YPosition + Placement.Width * 0.5f;
+    Obstacle.ZPosition = Placement.ZPosition + 50.0f;
+    Obstacle.PlatformIndex = PlatformIndex;
+
+    // Movement type: weighted per difficulty band (Static until tables are baked)
+    Obstacle.MovementType = static_cast<uint8>(EMovementType::Static);
+    if (MovementTypeTables.Num() > 0)
+    {
+        const int32 NumMovementTypes = static_cast<int32>(EMovementType::Zigzag) + 1;
+        Obstacle.MovementType = static_cast<uint8>(SampleWeighted(MovementTypeTables, NumMovementTypes, Difficulty,
+            Random.GetBits(PlatformIndex, EChunkRandomPurpose::ObstacleMovement)));
     }
 
-    // Difficulty 7+: All movement types including Circular/Zigzag
-    const int32 Choice = RandomStream.RandRange(0, 4);
-    switch (Choice)
+    return Obstacle;
+}
+
+void UProceduralLevelBuilder::LayoutWallSpike(const FChunkRandom& Random, FChunkLayout& Layout) const
+{
+    const float Difficulty = Layout.Difficulty;
+    const TArray<FPlatformPlacement>& Placements = Layout.Platforms;
+
+    // Wall spike: rare event at difficulty 5+ (5% chance per chunk)
+    if (Difficulty >= 5.0f && WallSpikeClass && Random.FRand(0, EChunkRandomPurpose::WallSpikeChance) < WallSpikeChancePerChunk)
     {
-    case 0: return static_cast<uint8>(EMovementType::Static);
-    case 1: return static_cast<uint8>(EMovementType::UpDown);
-    case 2: return static_cast<uint8>(EMovementType::LeftRight);
-    case 3: return static_cast<uint8>(EMovementType::Circular);
-    case 4: return static_cast<uint8>(EMovementType::Zigzag);
-    default: return static_cast<uint8>(EMovementType::Static);
+        // Place wall spike behind a random platform within the chunk
+        if (Placements.Num() > 2)
+        {
+            const int32 PlacementIndex = Random.RandRange(0, EChunkRandomPurpose::WallSpikePlacement, 1, Placements.Num() - 1);
+            const FPlatformPlacement& Placement = Placements[PlacementIndex];
+
+            Layout.bHasWallSpike = true;
+            Layout.WallSpikeLocation = FVector2D(Placement.YPosition - 500.0f, Placement.ZPosition);
+        }
     }
 }
 
 // ======================================================================
-// Coin Generation
+// Coin Layout
 // ======================================================================
 
-void UProceduralLevelBuilder::GenerateCoins(UWorld* World, float Difficulty, FRandomStream& RandomStream,
-    const TArray<FPlatformPlacement>& Placements, TArray<AActor*>& OutActors)
+void UProceduralLevelBuilder::LayoutCoins(const FChunkRandom& Random, FChunkLayout& Layout) const
 {
     if (!CoinClass)
     {
         return; // No coin class configured
     }
 
+    const TArray<FPlatformPlacement>& Placements = Layout.Platforms;
+
     for (const FPlatformPlacement& Placement : Placements)
     {
-        if (!Placement.bHasCollectible)
+        // Coins are static actors and would hang in the air over a moving platform
+        if (!Placement.bHasCollectible || Placement.bIsMoving)
         {
             continue;
         }
 
         // Place coin above center of platform
-        FVector CoinLocation(0.0f, Placement.YPosition + Placement.Width * 0.5f,
-                             Placement.ZPosition + CoinHeightOffset);
-
-        AActor* Coin = GetOrSpawnActor(CoinPool, CoinPoolGCRefs, World, CoinClass, CoinLocation);
-
-        // Reset coin state for reused coins
-        if (ACoinPickup* CoinPickup = Cast<ACoinPickup>(Coin))
-        {
-            CoinPickup->Respawn();
-        }
-
-        if (Coin)
-        {
-            OutActors.Add(Coin);
-        }
+        Layout.Coins.Add(FVector2D(Placement.YPosition + Placement.Width * 0.5f,
+                                   Placement.ZPosition + CoinHeightOffset));
     }
 
-    // Phase 4: Coin arcs between platforms (at higher difficulty)
-    if (Difficulty >= 3.0f && Placements.Num() >= 2)
+    // Coin arcs between platforms (at higher difficulty)
+    if (Layout.Difficulty >= 3.0f && Placements.Num() >= 2)
     {
         for (int32 i = 0; i < Placements.Num() - 1; ++i)
         {
             // 20% chance for a coin arc between platforms
-            if (RandomStream.FRand() > 0.2f)
+            if (Random.FRand(i, EChunkRandomPurpose::CoinArcChance) > 0.2f)
             {
                 continue;
             }
@@ -382,35 +1010,78 @@ void UProceduralLevelBuilder::GenerateCoins(UWorld* World, float Difficulty, FRa
             const FPlatformPlacement& Current = Placements[i];
             const FPlatformPlacement& Next = Placements[i + 1];
 
-            const float GapCenter = Current.YPosition + Current.Width +
-                                    (Next.YPosition - (Current.YPosition + Current.Width)) * 0.5f;
-            const float ArcHeight = FMath::Max(Current.ZPosition, Next.ZPosition) + 200.0f;
+            AddCoinArc(Layout.Coins, Current.YPosition + Current.Width, Next.YPosition,
+                       FMath::Max(Current.ZPosition, Next.ZPosition) + 200.0f);
+        }
+    }
+}
+
+void UProceduralLevelBuilder::AddCoinArc(TArray<FVector2D>& Coins, float StartY, float EndY, float ArcHeight)
+{
+    // Place 3 coins in an arc pattern
+    for (int32 CoinIdx = 0; CoinIdx < 3; ++CoinIdx)
+    {
+        const float T = (CoinIdx + 1) / 4.0f;
+        const float CoinY = FMath::Lerp(StartY, EndY, T);
+        const float ParabolaT = T * 2.0f - 1.0f; // Map to [-1, 1]
+        const float CoinZ = ArcHeight - (ParabolaT * ParabolaT * 100.0f);
 
-            // Place 3 coins in an arc pattern
-            for (int32 CoinIdx = 0; CoinIdx < 3; ++CoinIdx)
-            {
-                const float T = (CoinIdx + 1) / 4.0f;
-                const float CoinY = FMath::Lerp(Current.YPosition + Current.Width, Next.YPosition, T);
-                const float ParabolaT = T * 2.0f - 1.0f; // Map to [-1, 1]
-                const float CoinZ = ArcHeight - (ParabolaT * ParabolaT * 100.0f);
+        Coins.Add(FVector2D(CoinY, CoinZ));
+    }
+}
 
-                const FVector ArcCoinLocation(0.0f, CoinY, CoinZ);
+// ======================================================================
+// Enemy Layout
+// ======================================================================
 
-                AActor* ArcCoin = GetOrSpawnActor(CoinPool, CoinPoolGCRefs, World, CoinClass, ArcCoinLocation);
+void UProceduralLevelBuilder::LayoutEnemies(const FChunkRandom& Random, FChunkLayout& Layout) const
+{
+    if (!EnemyClass || Layout.Difficulty < EnemyMinDifficulty)
+    {
+        return; // Enemies only appear at high difficulty
+    }
 
-                // Reset coin state for reused coins
-                if (ACoinPickup* CoinPickup = Cast<ACoinPickup>(ArcCoin))
-                {
-                    CoinPickup->Respawn();
-                }
+    const TArray<FPlatformPlacement>& Placements = Layout.Platforms;
 
-                if (ArcCoin)
-                {
-                    OutActors.Add(ArcCoin);
-                }
-            }
+    // Platforms already holding an obstacle stay enemy-free
+    TBitArray<> OccupiedPlatforms(false, Placements.Num());
+    for (const FObstaclePlacement& Obstacle : Layout.Obstacles)
+    {
+        if (OccupiedPlatforms.IsValidIndex(Obstacle.PlatformIndex))
+        {
+            OccupiedPlatforms[Obstacle.PlatformIndex] = true;
         }
     }
+
+    // Chance ramps from a quarter of the max at EnemyMinDifficulty up to the max at difficulty 10
+    const float EnemyAlpha = EnemyMinDifficulty < 10.0f
+        ? FMath::Clamp((Layout.Difficulty - EnemyMinDifficulty) / (10.0f - EnemyMinDifficulty), 0.0f, 1.0f)
+        : 1.0f;
+    const float EnemyChance = FMath::Lerp(MaxEnemyChancePerPlatform * 0.25f, MaxEnemyChancePerPlatform, EnemyAlpha);
+
+    // Skip first platform (safe landing zone) and moving platforms (patrol needs fixed ground)
+    for (int32 i = 1; i < Placements.Num(); ++i)
+    {
+        const FPlatformPlacement& Placement = Placements[i];
+        if (OccupiedPlatforms[i] || Placement.bIsMoving)
+        {
+            continue;
+        }
+
+        if (Random.FRand(i, EChunkRandomPurpose::EnemyChance) >= EnemyChance)
+        {
+            continue;
+        }
+
+        FEnemyPlacement Enemy;
+        Enemy.YPosition = Placement.YPosition + Placement.Width * 0.5f;
+        Enemy.ZPosition = Placement.ZPosition + EnemyHeightOffset;
+
+        // Patrol back and forth without walking off the platform
+        Enemy.PatrolDistance = FMath::Max(0.0f, Placement.Width * 0.5f - EnemyPatrolEdgeMargin);
+
+        Layout.Enemies.Add(Enemy);
+    }
 }
 
 // ======================================================================
@@ -446,6 +1117,11 @@ bool UProceduralLevelBuilder::IsPlatformActor(const AActor* Actor) const
 
 void UProceduralLevelBuilder::ReturnActorsToPool(const TArray<AActor*>& Actors)
 {
+    TArray<AActor*> PoolableActors;
+    PoolableActors.Reserve(Actors.Num());
+
+    TArray<ACoinPickup*, TInlineAllocator<32>> Coins;
+
     for (AActor* Actor : Actors)
     {
         if (!IsValid(Actor))
@@ -453,38 +1129,76 @@ void UProceduralLevelBuilder::ReturnActorsToPool(const TArray<AActor*>& Actors)
             continue;
         }
 
-        // Deactivate the actor
-        Actor->SetActorHiddenInGame(true);
-        Actor->SetActorEnableCollision(false);
-        Actor->SetActorTickEnabled(false);
-
         // Return to appropriate pool based on class and add GC root reference
-        if (Actor->IsA(ASpikes::StaticClass()))
+        if (ASimpleEnemy* SimpleEnemy = Cast<ASimpleEnemy>(Actor))
+        {
+            SimpleEnemy->DeactivateForPool();
+            EnemyPool.ReturnActor(Actor, Actor->GetClass()->GetFName());
+            EnemyPoolGCRefs.AddUnique(Actor);
+        }
+        else if (AEnemyCharacter* EnemyCharacter = Cast<AEnemyCharacter>(Actor))
+        {
+            // Patrol runs on timers, which dormancy alone does not stop
+            EnemyCharacter->DeactivateForPool();
+            EnemyPool.ReturnActor(Actor, Actor->GetClass()->GetFName());
+            EnemyPoolGCRefs.AddUnique(Actor);
+        }
+        else if (AWallSpike* WallSpike = Cast<AWallSpike>(Actor))
+        {
+            // Checked before ASpikes: wall spikes chase the player and keep their own pool
+            WallSpike->DeactivateForPool();
+            WallSpikePool.ReturnActor(Actor, Actor->GetClass()->GetFName());
+            WallSpikePoolGCRefs.AddUnique(Actor);
+        }
+        else if (Actor->IsA(ASpikes::StaticClass()))
         {
-            ObstaclePool.ReturnActor(Actor);
+            ObstaclePool.ReturnActor(Actor, Actor->GetClass()->GetFName());
             ObstaclePoolGCRefs.AddUnique(Actor);
         }
-        else if (Actor->IsA(ACoinPickup::StaticClass()))
+        else if (ACoinPickup* Coin = Cast<ACoinPickup>(Actor))
         {
-            CoinPool.ReturnActor(Actor);
-            CoinPoolGCRefs.AddUnique(Actor);
+            // Released in one batch to the world coin pool below
+            Coins.Add(Coin);
+            continue;
         }
         else if (IsPlatformActor(Actor))
         {
-            PlatformPool.ReturnActor(Actor);
+            RemoveMovingPlatform(Actor);
+            PlatformPool.ReturnActor(Actor, Actor->GetClass()->GetFName());
             PlatformPoolGCRefs.AddUnique(Actor);
         }
         else
         {
-            // Unknown actor type (e.g. WallSpike) — not pooled, just destroy
+            // Unknown actor type — not pooled, just destroy
             UE_LOG(LogSideRunner, Verbose, TEXT("ReturnActorsToPool: Actor %s not poolable, destroying"), *Actor->GetName());
             Actor->Destroy();
+            continue;
+        }
+
+        PoolableActors.Add(Actor);
+    }
+
+    // PERFORMANCE: Put the whole chunk to sleep in one pass
+    ABaseLevel::SetActorsDormant(PoolableActors, true, DormancyMode);
+
+    UCoinPoolSubsystem* CoinPool = GetWorld() ? GetWorld()->GetSubsystem<UCoinPoolSubsystem>() : nullptr;
+    if (CoinPool)
+    {
+        CoinPool->ReleaseCoins(Coins, DormancyMode);
+        CoinPool->UnregisterChunkCoins(Coins.Num());
+    }
+    else
+    {
+        for (ACoinPickup* Coin : Coins)
+        {
+            Coin->Destroy();
         }
     }
 
 #if UE_BUILD_DEVELOPMENT
-    UE_LOG(LogSideRunner, Verbose, TEXT("ProceduralLevelBuilder: Returned %d actors to pools (Platform=%d, Obstacle=%d, Coin=%d)"),
-           Actors.Num(), PlatformPool.GetPooledCount(), ObstaclePool.GetPooledCount(), CoinPool.GetPooledCount());
+    UE_LOG(LogSideRunner, Verbose, TEXT("ProceduralLevelBuilder: Returned %d actors to pools (Platform=%d, Obstacle=%d, Enemy=%d, WallSpike=%d, Coin=%d)"),
+           Actors.Num(), PlatformPool.GetPooledCount(), ObstaclePool.GetPooledCount(), EnemyPool.GetPooledCount(),
+           WallSpikePool.GetPooledCount(), CoinPool ? CoinPool->GetStats().NumFree : 0);
 #endif
 }
 
@@ -492,9 +1206,125 @@ void UProceduralLevelBuilder::ClearPools()
 {
     PlatformPool.Clear();
     ObstaclePool.Clear();
-    CoinPool.Clear();
+    EnemyPool.Clear();
+    WallSpikePool.Clear();
 
     PlatformPoolGCRefs.Empty();
     ObstaclePoolGCRefs.Empty();
-    CoinPoolGCRefs.Empty();
+    EnemyPoolGCRefs.Empty();
+    WallSpikePoolGCRefs.Empty();
+
+    MovingPlatformActors.Empty();
+    MovingPlatformMotions.Empty();
+
+    if (IsValid(ProxyCoinField))
+    {
+        ProxyCoinField->ClearCoins();
+    }
+}
+
+// ======================================================================
+// Proxy Coins
+// ======================================================================
+
+int32 UProceduralLevelBuilder::SpawnProxyCoins(UWorld* World, const FChunkLayout& Layout, float StartY)
+{
+    if (!bUseProxyCoins || !World || !CoinClass)
+    {
+        return INDEX_NONE;
+    }
+
+    UCoinPoolSubsystem* CoinPool = World->GetSubsystem<UCoinPoolSubsystem>();
+    if (Layout.Coins.Num() == 0)
+    {
+        if (CoinPool)
+        {
+            CoinPool->RegisterChunkCoins(Layout.ChunkIndex, 0);
+        }
+        return INDEX_NONE;
+    }
+
+    const ACoinPickup* CoinDefaults = CoinClass->GetDefaultObject<ACoinPickup>();
+
+    if (!IsValid(ProxyCoinField))
+    {
+        ProxyCoinField = World->SpawnActor<ACoinField>(ACoinField::StaticClass(), FTransform::Identity);
+        if (!ProxyCoinField)
+        {
+            UE_LOG(LogSideRunner, Error, TEXT("ProceduralLevelBuilder: Failed to spawn proxy coin field"));
+            return INDEX_NONE;
+        }
+
+        UStaticMeshComponent* DefaultMesh = CoinDefaults->CoinMesh;
+        ProxyCoinField->Configure(DefaultMesh ? DefaultMesh->GetStaticMesh() : nullptr,
+                                  DefaultMesh ? DefaultMesh->GetRelativeScale3D() : FVector::OneVector,
+                                  CoinDefaults->CollectEffect, CoinDefaults->CollectSound);
+    }
+
+    TArray<FVector, TInlineAllocator<32>> Locations;
+    Locations.Reserve(Layout.Coins.Num());
+    for (const FVector2D& CoinPosition : Layout.Coins)
+    {
+        Locations.Add(FVector(0.0f, StartY + CoinPosition.X, CoinPosition.Y));
+    }
+
+    if (CoinPool)
+    {
+        CoinPool->RegisterChunkCoins(Layout.ChunkIndex, Locations.Num());
+    }
+
+    return ProxyCoinField->AddCoinBlock(Locations, CoinDefaults->CoinValue);
+}
+
+void UProceduralLevelBuilder::ReleaseProxyCoins(int32 CoinBlock)
+{
+    if (CoinBlock != INDEX_NONE && IsValid(ProxyCoinField))
+    {
+        const int32 NumCoins = ProxyCoinField->RemoveCoinBlock(CoinBlock);
+
+        if (UCoinPoolSubsystem* CoinPool = GetWorld() ? GetWorld()->GetSubsystem<UCoinPoolSubsystem>() : nullptr)
+        {
+            CoinPool->UnregisterChunkCoins(NumCoins);
+        }
+    }
+}
+
+// ======================================================================
+// Moving Platforms
+// ======================================================================
+
+void UProceduralLevelBuilder::UpdateMovingPlatforms(double TimeSeconds)
+{
+    // PERFORMANCE: One tight pass over all moving platforms. Positions are closed-form in time,
+    // so there is no per-platform state to integrate and pooled or replayed chunks stay in sync.
+    for (int32 i = 0; i < MovingPlatformActors.Num(); ++i)
+    {
+        AActor* Platform = MovingPlatformActors[i];
+        USceneComponent* Root = IsValid(Platform) ? Platform->GetRootComponent() : nullptr;
+        if (!Root)
+        {
+            continue;
+        }
+
+        const FMovingPlatformMotion& Motion = MovingPlatformMotions[i];
+
+        // Wrap the angle in double precision so long runs don't lose float resolution
+        const double Angle = FMath::Fmod(TimeSeconds * Motion.AngularFrequency, UE_DOUBLE_TWO_PI) + Motion.Phase;
+
+        FVector Location = Motion.BaseLocation;
+        Location.Y += Motion.Amplitude * FMath::Sin(Angle);
+
+        // No sweep: the layout already guarantees the swept span is clear; riders follow via their movement base
+        Root->SetWorldLocation(Location);
+    }
+}
+
+void UProceduralLevelBuilder::RemoveMovingPlatform(AActor* Platform)
+{
+    const int32 Index = MovingPlatformActors.Find(Platform);
+    if (Index != INDEX_NONE)
+    {
+        MovingPlatformActors.RemoveAtSwap(Index);
+        MovingPlatformMotions.RemoveAtSwap(Index);
+    }
 }
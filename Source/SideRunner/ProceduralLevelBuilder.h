@@ -4,18 +4,56 @@
 #include "Components/ActorComponent.h"
 #include "EndlessRunnerTypes.h"
 #include "ActorPool.h"
+#include "ChunkRandom.h"
+#include "ChunkLayoutCache.h"
+#include "AliasTable.h"
+#include "FeaturePatternTable.h"
+#include "Spikes.h"
 #include "ProceduralLevelBuilder.generated.h"
 
-class ASpikes;
 class ACoinPickup;
-class ASimpleEnemy;
+class ACoinField;
+
+/**
+ * Designer weights for obstacle movement types from a given difficulty up.
+ * Movement types missing from the map are never picked in this band; an empty map
+ * (or all-zero weights) picks only Static.
+ */
+USTRUCT(BlueprintType)
+struct FMovementWeightBand
+{
+    GENERATED_BODY()
+
+    /** Lowest difficulty (inclusive) this band applies to */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weights", meta = (ClampMin = "1.0", ClampMax = "10.0"))
+    float MinDifficulty = 1.0f;
+
+    /** Relative weight per movement type */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weights")
+    TMap<EMovementType, float> Weights;
+};
+
+/**
+ * Closed-form motion of one moving platform: Y = Base.Y + Amplitude * sin(AngularFrequency * t + Phase).
+ */
+struct FMovingPlatformMotion
+{
+    FVector BaseLocation = FVector::ZeroVector;
+    float Amplitude = 0.0f;
+    float AngularFrequency = 0.0f;
+    float Phase = 0.0f;
+};
 
 /**
  * Core procedural content generation component for ChromaRunner.
  * Attached to ASpawnLevel. Generates platforms, obstacles, and coins
- * using a controlled random walk algorithm with difficulty-driven parameters.
+ * using a controlled random walk with difficulty-driven parameters, or by expanding
+ * authored feature patterns (EChunkGeneratorMode::PatternLibrary).
+ * Generation is split into a spawn-free layout phase (thread-safe, parallelizable)
+ * and a spawn phase that realizes a layout on the game thread.
  *
- * PERFORMANCE: Uses FRandomStream for deterministic generation, FActorPool for reuse.
+ * PERFORMANCE: Uses counter-based FChunkRandom for deterministic, order-independent
+ * generation, FActorPool for reuse.
  * Follows UE5 skill guidelines: no tick, cached references, UPROPERTY on all UObject*.
  */
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
@@ -26,6 +64,13 @@ class SIDERUNNER_API UProceduralLevelBuilder : public UActorComponent
 public:
     UProceduralLevelBuilder();
 
+    virtual void OnRegister() override;
+    virtual void BeginPlay() override;
+
+#if WITH_EDITOR
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
     // ======================================================================
     // Core Generation API
     // ======================================================================
@@ -36,11 +81,85 @@ public:
      * @param World - World context for spawning actors
      * @param StartY - Y-axis start position for this chunk
      * @param Difficulty - Difficulty level (1.0 to 10.0)
-     * @param Seed - Random seed for deterministic generation
+     * @param Seed - Run seed for deterministic generation
+     * @param ChunkIndex - Index of this chunk within the run (combined with Seed for randomness)
      * @return Array of spawned actors (attached to parent level)
      */
     UFUNCTION(BlueprintCallable, Category = "Procedural Generation")
-    TArray<AActor*> GenerateLevelContent(UWorld* World, float StartY, float Difficulty, int32 Seed);
+    TArray<AActor*> GenerateLevelContent(UWorld* World, float StartY, float Difficulty, int32 Seed, int32 ChunkIndex = 0);
+
+    /**
+     * Computes the layout of a single chunk without spawning anything.
+     * Pure function of its inputs and the builder config — safe to call from worker threads.
+     *
+     * @param Difficulty - Difficulty level (1.0 to 10.0)
+     * @param Seed - Run seed for deterministic generation
+     * @param ChunkIndex - Index of this chunk within the run
+     * @return Chunk-local layout
+     */
+    UFUNCTION(BlueprintCallable, Category = "Procedural Generation")
+    FChunkLayout GenerateChunkLayout(float Difficulty, int32 Seed, int32 ChunkIndex) const;
+
+    /**
+     * Computes layouts for a contiguous range of chunks concurrently on the task graph.
+     * Difficulties are quantized like GetOrGenerateChunkLayout, so results match what the spawn path builds.
+     *
+     * @param Seed - Run seed for deterministic generation
+     * @param FirstChunkIndex - Chunk index of the first layout in the range
+     * @param ChunkDifficulties - Difficulty for each chunk; the range length is its Num()
+     * @return One layout per entry in ChunkDifficulties, in chunk order
+     */
+    UFUNCTION(BlueprintCallable, Category = "Procedural Generation")
+    TArray<FChunkLayout> GenerateChunkLayoutRange(int32 Seed, int32 FirstChunkIndex, const TArray<float>& ChunkDifficulties) const;
+
+    /**
+     * Generates a range of chunk layouts in parallel and stores them in the layout cache,
+     * under the same keys GetOrGenerateChunkLayout looks up. Chunks already cached are skipped.
+     *
+     * @param Seed - Run seed for deterministic generation
+     * @param FirstChunkIndex - Chunk index of the first layout in the range
+     * @param ChunkDifficulties - Difficulty for each chunk; the range length is its Num()
+     * @return Number of layouts generated and added
+     */
+    UFUNCTION(BlueprintCallable, Category = "Procedural Generation")
+    int32 PrewarmLayoutCache(int32 Seed, int32 FirstChunkIndex, const TArray<float>& ChunkDifficulties);
+
+    /**
+     * Returns the layout for a chunk from the LRU layout cache, generating and caching it on miss.
+     * Difficulty is quantized to DifficultyBucketsPerLevel steps so nearby difficulties share entries.
+     *
+     * @param Difficulty - Difficulty level (1.0 to 10.0), quantized before generation
+     * @param Seed - Run seed for deterministic generation
+     * @param ChunkIndex - Index of this chunk within the run
+     * @return Chunk-local layout
+     */
+    FChunkLayout GetOrGenerateChunkLayout(float Difficulty, int32 Seed, int32 ChunkIndex);
+
+    /** Drops all cached chunk layouts. */
+    UFUNCTION(BlueprintCallable, Category = "Procedural Generation")
+    void ClearLayoutCache();
+
+    /** Returns layout cache hit/miss counters and memory footprint. */
+    FChunkLayoutCacheStats GetLayoutCacheStats() const { return LayoutCache.GetStats(); }
+
+    /**
+     * Rebuilds the per-difficulty alias tables from the weight bands and recompiles the
+     * feature pattern table. Called automatically on register and on edit; call manually
+     * after changing weights, variants, obstacle classes or patterns at runtime.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Procedural Generation")
+    void RebuildSamplingTables();
+
+    /**
+     * Spawns (or pulls from pools) the actors described by a layout.
+     *
+     * @param World - World context for spawning actors
+     * @param Layout - Chunk-local layout to realize
+     * @param StartY - World Y-axis position of the chunk start
+     * @return Array of spawned actors
+     */
+    UFUNCTION(BlueprintCallable, Category = "Procedural Generation")
+    TArray<AActor*> SpawnChunkLayout(UWorld* World, const FChunkLayout& Layout, float StartY);
 
     /**
      * Returns spawned actors to pools for reuse. Call before destroying a level.
@@ -54,6 +173,27 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Procedural Generation")
     void ClearPools();
 
+    /**
+     * Adds a layout's coins to the shared proxy coin field (bUseProxyCoins only).
+     *
+     * @param World - World context for spawning the coin field on first use
+     * @param Layout - Chunk-local layout whose coins to add
+     * @param StartY - World Y-axis position of the chunk start
+     * @return Coin block handle for ReleaseProxyCoins, or INDEX_NONE if no proxy coins were added
+     */
+    int32 SpawnProxyCoins(UWorld* World, const FChunkLayout& Layout, float StartY);
+
+    /** Removes a chunk's proxy coins. Call with the handle from SpawnProxyCoins before recycling a level. */
+    void ReleaseProxyCoins(int32 CoinBlock);
+
+    /**
+     * Moves every live moving platform to its position at the given time.
+     * Called once per frame by the owning ASpawnLevel — platforms themselves never tick.
+     *
+     * @param TimeSeconds - World time; positions are a pure function of it
+     */
+    void UpdateMovingPlatforms(double TimeSeconds);
+
     // ======================================================================
     // Platform Configuration
     // ======================================================================
@@ -90,6 +230,29 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Platform Config", meta = (ClampMin = "1.0", ClampMax = "1000.0"))
     float BasePlatformMeshSize;
 
+    /** How far moving platforms slide either way along Y (capped so every gap stays jumpable). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Platform Config", meta = (ClampMin = "0.0", ClampMax = "500.0"))
+    float MovingPlatformAmplitude;
+
+    /** Seconds per back-and-forth cycle at difficulty 1 (shortens to 60% at difficulty 10). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Platform Config", meta = (ClampMin = "0.5", ClampMax = "20.0"))
+    float MovingPlatformPeriod;
+
+    // ======================================================================
+    // Pattern Library
+    // ======================================================================
+
+    /** Random walk per platform, or composition from FeaturePatterns. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pattern Library")
+    EChunkGeneratorMode GeneratorMode;
+
+    /**
+     * Authored patterns for PatternLibrary mode, compiled into flat tables by RebuildSamplingTables.
+     * Difficulties no pattern covers fall back to the random walk.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pattern Library")
+    TArray<FFeaturePattern> FeaturePatterns;
+
     // ======================================================================
     // Obstacle Configuration
     // ======================================================================
@@ -102,14 +265,66 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Obstacle Config")
     TSubclassOf<ACoinPickup> CoinClass;
 
-    /** Enemy class for spawning on platforms at high difficulty. */
+    /** Enemy class (ASimpleEnemy or AEnemyCharacter subclass) for spawning on platforms at high difficulty. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Obstacle Config")
-    TSubclassOf<ASimpleEnemy> EnemyClass;
+    TSubclassOf<AActor> EnemyClass;
+
+    /** Difficulty at which enemies start appearing on platforms. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Obstacle Config", meta = (ClampMin = "1.0", ClampMax = "10.0"))
+    float EnemyMinDifficulty;
+
+    /** Chance per free platform to hold an enemy at difficulty 10 (ramps up from EnemyMinDifficulty). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Obstacle Config", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float MaxEnemyChancePerPlatform;
 
     /** Wall spike class for rare high-difficulty events. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Obstacle Config")
     TSubclassOf<AActor> WallSpikeClass;
 
+    // ======================================================================
+    // Selection Weights (sampled via precomputed alias tables)
+    // ======================================================================
+
+    /** Weights over PlatformVariants per difficulty band. Empty = uniform. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Selection Weights")
+    TArray<FSelectionWeightBand> PlatformVariantWeightBands;
+
+    /** Weights over ObstacleClasses per difficulty band. Empty = uniform. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Selection Weights")
+    TArray<FSelectionWeightBand> ObstacleClassWeightBands;
+
+    /** Weights over obstacle movement types per difficulty band. Empty = Static only. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Selection Weights")
+    TArray<FMovementWeightBand> MovementTypeWeightBands;
+
+    // ======================================================================
+    // Pooling
+    // ======================================================================
+
+    /** How pooled actors are put to sleep in ReturnActorsToPool and woken on reuse; also applied to procedural chunk levels. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pooling")
+    EChunkDormancyMode DormancyMode;
+
+    /** Coins spawned into the world's coin pool at BeginPlay so early chunks reuse instead of spawn. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pooling", meta = (ClampMin = "0", ClampMax = "512"))
+    int32 CoinPrewarmCount;
+
+    /**
+     * Generate coins as proxies in one shared ACoinField (table + instanced mesh, radius-checked collection)
+     * instead of ACoinPickup actors. Proxies take their mesh, value and effects from CoinClass but do not
+     * hover, rotate or respond to magnetism.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pooling")
+    bool bUseProxyCoins;
+
+    // ======================================================================
+    // Layout Cache
+    // ======================================================================
+
+    /** Memory cap for cached chunk layouts in KB (0 disables caching). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Layout Cache", meta = (ClampMin = "0", ClampMax = "16384"))
+    int32 LayoutCacheMaxKB;
+
     // ======================================================================
     // Jump Physics Constraints (used for gap validation)
     // ======================================================================
@@ -143,54 +358,100 @@ private:
     // Generation Helpers
     // ======================================================================
 
-    /** Spawns platforms along the chunk using controlled random walk. */
-    void GeneratePlatforms(UWorld* World, float StartY, float Difficulty, FRandomStream& RandomStream,
-                           TArray<AActor*>& OutActors, TArray<FPlatformPlacement>& OutPlacements);
+    /** Lays out platforms along the chunk using controlled random walk. */
+    void LayoutPlatforms(const FChunkRandom& Random, FChunkLayout& Layout) const;
 
-    /** Spawns obstacles on platforms based on difficulty. */
-    void GenerateObstacles(UWorld* World, float Difficulty, FRandomStream& RandomStream,
-                           const TArray<FPlatformPlacement>& Placements, TArray<AActor*>& OutActors);
+    /** Lays out platforms, obstacle slots and coin slots by expanding feature patterns. */
+    void LayoutPatterns(const FChunkRandom& Random, FChunkLayout& Layout) const;
 
-    /** Spawns coins above platforms. */
-    void GenerateCoins(UWorld* World, float Difficulty, FRandomStream& RandomStream,
-                       const TArray<FPlatformPlacement>& Placements, TArray<AActor*>& OutActors);
+    /** Lays out obstacles on platforms based on difficulty. */
+    void LayoutObstacles(const FChunkRandom& Random, FChunkLayout& Layout) const;
+
+    /** Rolls the rare wall spike event behind one of the chunk's platforms. */
+    void LayoutWallSpike(const FChunkRandom& Random, FChunkLayout& Layout) const;
+
+    /** Lays out coins above platforms and in arcs across gaps. */
+    void LayoutCoins(const FChunkRandom& Random, FChunkLayout& Layout) const;
+
+    /** Lays out patrolling enemies on obstacle-free platforms at high difficulty. */
+    void LayoutEnemies(const FChunkRandom& Random, FChunkLayout& Layout) const;
 
     /** Computes max jump distances from physics constants. */
     void CalculateJumpDistances();
 
     /**
-     * Retrieves an actor from the specified pool, or spawns a new one if the pool is empty.
+     * Retrieves an actor of ActorClass from the specified pool, or spawns a new one if that sub-pool is empty.
      * Handles GC ref array bookkeeping and actor reactivation.
      *
-     * @param Pool - Actor pool to check
+     * @param Pool - Actor pool to check (sub-pools are keyed by class name)
      * @param GCRefs - GC root reference array for this pool
      * @param World - World context for spawning
-     * @param ActorClass - Class to spawn if pool is empty
+     * @param ActorClass - Class to reuse or spawn
      * @param SpawnLocation - Location for the actor
      * @return Retrieved or newly spawned actor, or nullptr on failure
      */
     AActor* GetOrSpawnActor(FActorPool<AActor>& Pool, TArray<AActor*>& GCRefs,
                             UWorld* World, UClass* ActorClass, const FVector& SpawnLocation);
 
+    /** Builds the obstacle for a platform: weighted class and movement type, centered on top. */
+    FObstaclePlacement MakeObstaclePlacement(const FChunkRandom& Random, float Difficulty,
+                                             const FPlatformPlacement& Placement, int32 PlatformIndex) const;
+
+    /** Appends a three-coin arc spanning the gap between StartY and EndY. */
+    static void AddCoinArc(TArray<FVector2D>& Coins, float StartY, float EndY, float ArcHeight);
+
+    /** Moving platform amplitude, capped so a gap between two moving platforms stays jumpable. */
+    float GetMovingPlatformAmplitude() const;
+
     /** Returns a difficulty alpha in [0,1] from difficulty [1,10]. */
     FORCEINLINE float GetDifficultyAlpha(float Difficulty) const
     {
         return FMath::Clamp((Difficulty - 1.0f) / 9.0f, 0.0f, 1.0f);
     }
 
-    /** Selects an obstacle movement type appropriate for the difficulty. */
-    uint8 SelectMovementTypeForDifficulty(float Difficulty, FRandomStream& RandomStream) const;
+    /**
+     * Samples an option index from the alias table for the difficulty's band.
+     * Falls back to a uniform pick if the tables are stale for NumOptions.
+     *
+     * @param Tables - Per-band alias tables (one per whole difficulty level)
+     * @param NumOptions - Current number of options in the source array
+     * @param Difficulty - Difficulty level (1.0 to 10.0)
+     * @param RandomBits - Uniform random bits from FChunkRandom
+     * @return Option index, or INDEX_NONE if NumOptions is 0
+     */
+    int32 SampleWeighted(const TArray<FAliasTable>& Tables, int32 NumOptions, float Difficulty, uint32 RandomBits) const;
+
+    /** Builds one alias table per difficulty band from index-aligned weight bands. */
+    static void BuildBandTables(const TArray<FSelectionWeightBand>& Bands, int32 NumOptions, TArray<FAliasTable>& OutTables);
+
+    /** Hashes every config value that affects layout output, for layout cache keys. */
+    uint32 ComputeLayoutConfigHash() const;
+
+    /** Rounds a difficulty to its layout cache bucket (DifficultyBucketsPerLevel steps per level). */
+    static int32 GetDifficultyBucket(float Difficulty);
+
+    /** Difficulty a chunk is actually generated at: the centre of its bucket. */
+    static float QuantizeDifficulty(float Difficulty);
+
+    /** Layout cache key for a chunk; ConfigHash is passed in so ranges hash the config once. */
+    static FChunkLayoutKey MakeLayoutKey(int32 Seed, int32 ChunkIndex, float Difficulty, uint32 ConfigHash);
 
     /** Returns true if the actor matches PlatformClass or any PlatformVariant class. */
     bool IsPlatformActor(const AActor* Actor) const;
 
+    /** Drops a platform from the moving set (no-op if it is static). */
+    void RemoveMovingPlatform(AActor* Platform);
+
     // ======================================================================
     // Object Pools
     // ======================================================================
 
     FActorPool<AActor> PlatformPool;
     FActorPool<AActor> ObstaclePool;
-    FActorPool<AActor> CoinPool;
+    FActorPool<AActor> EnemyPool;
+    FActorPool<AActor> WallSpikePool;
+
+    // Coins are pooled by the world's UCoinPoolSubsystem (shared with ACoinPickup::SpawnFromPool).
 
     // GC roots: mirror arrays keep pooled actors referenced so UE GC doesn't collect them
     // while they sit in FActorPool (which uses raw pointers outside UPROPERTY).
@@ -201,7 +462,47 @@ private:
     TArray<AActor*> ObstaclePoolGCRefs;
 
     UPROPERTY()
-    TArray<AActor*> CoinPoolGCRefs;
+    TArray<AActor*> EnemyPoolGCRefs;
+
+    UPROPERTY()
+    TArray<AActor*> WallSpikePoolGCRefs;
+
+    /** Shared proxy coin field (bUseProxyCoins), spawned on first use. */
+    UPROPERTY()
+    ACoinField* ProxyCoinField;
+
+    // ======================================================================
+    // Moving Platforms (batched: one update pass, no per-actor tick)
+    // ======================================================================
+
+    /** Live moving platforms, index-aligned with MovingPlatformMotions. */
+    UPROPERTY()
+    TArray<AActor*> MovingPlatformActors;
+
+    TArray<FMovingPlatformMotion> MovingPlatformMotions;
+
+    /** LRU cache of chunk layouts keyed by (seed, chunk, difficulty bucket, config hash). */
+    FChunkLayoutCache LayoutCache;
+
+    /** Difficulty quantization steps per whole difficulty level for layout cache keys. */
+    static constexpr int32 DifficultyBucketsPerLevel = 4;
+
+    // ======================================================================
+    // Alias Tables (one per whole difficulty level, built by RebuildSamplingTables)
+    // ======================================================================
+
+    TArray<FAliasTable> PlatformVariantTables;
+    TArray<FAliasTable> ObstacleClassTables;
+    TArray<FAliasTable> MovementTypeTables;
+
+    /** Hash of the weight bands the tables were built from (part of layout cache keys). */
+    uint32 SamplingTablesHash = 0;
+
+    /** FeaturePatterns flattened for table expansion. */
+    FFeaturePatternTable PatternTable;
+
+    /** Number of difficulty bands with a baked table (difficulty 1 through 10). */
+    static constexpr int32 NumDifficultyBands = 10;
 
     /** Base ground Z-level. */
     static constexpr float BaseGroundZ = 0.0f;
@@ -209,6 +510,12 @@ private:
     /** Height above platform to place coins. */
     static constexpr float CoinHeightOffset = 150.0f;
 
+    /** Height above platform to place enemies. */
+    static constexpr float EnemyHeightOffset = 100.0f;
+
+    /** Gap kept between an enemy's patrol span and the platform edges. */
+    static constexpr float EnemyPatrolEdgeMargin = 25.0f;
+
     /** Wall spike spawn chance per chunk at difficulty 5+. */
     static constexpr float WallSpikeChancePerChunk = 0.05f;
 };
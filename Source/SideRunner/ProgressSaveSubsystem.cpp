@@ -0,0 +1,205 @@
+#include "ProgressSaveSubsystem.h"
+#include "Kismet/GameplayStatics.h"
+#include "SideRunner.h" // Custom log categories
+
+void UProgressSaveSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    SlotObjects[0] = nullptr;
+    SlotObjects[1] = nullptr;
+
+    // Read both slots in the background; the newest valid one wins
+    PendingLoads = 2;
+    for (int32 SlotIndex = 0; SlotIndex < 2; ++SlotIndex)
+    {
+        UGameplayStatics::AsyncLoadGameFromSlot(ProgressSaveConstants::SLOT_NAMES[SlotIndex], ProgressSaveConstants::USER_INDEX,
+            FAsyncLoadGameFromSlotDelegate::CreateUObject(this, &UProgressSaveSubsystem::HandleSlotLoaded));
+    }
+}
+
+void UProgressSaveSubsystem::Deinitialize()
+{
+    // Shutting down: a final synchronous write is the only way to keep unsaved progress.
+    // Skipped while loading, so an unread save is never overwritten with partial data.
+    if (bLoaded && bDirty)
+    {
+        // An in-flight write holds an older snapshot and targets the slot after NewestSlot.
+        // Write the other slot with a later sequence, so the newer state wins on load whichever finishes.
+        const int32 NextSlot = NewestSlot == 0 ? 1 : 0;
+        const int32 SlotIndex = bWriteInFlight ? 1 - NextSlot : NextSlot;
+        const int64 Sequence = bWriteInFlight ? LastSequence + 2 : LastSequence + 1;
+        if (USideRunnerSaveGame* SaveObject = PrepareSaveObject(SlotIndex, Sequence))
+        {
+            UGameplayStatics::SaveGameToSlot(SaveObject, ProgressSaveConstants::SLOT_NAMES[SlotIndex], ProgressSaveConstants::USER_INDEX);
+        }
+    }
+
+    OnProgressLoaded.Clear();
+    Super::Deinitialize();
+}
+
+// ======================================================================
+// Progress Updates
+// ======================================================================
+
+void UProgressSaveSubsystem::AddPersistentCoins(int32 Amount)
+{
+    if (Amount <= 0)
+    {
+        return;
+    }
+
+    Progress.PersistentCoins = static_cast<int32>(FMath::Min<int64>(static_cast<int64>(Progress.PersistentCoins) + Amount, MAX_int32));
+    MarkDirty();
+}
+
+void UProgressSaveSubsystem::SubmitHighScore(int32 Score)
+{
+    if (Score > Progress.HighScore)
+    {
+        Progress.HighScore = Score;
+        MarkDirty();
+    }
+}
+
+void UProgressSaveSubsystem::RecordRunFinished(int32 Score, float DistanceMeters)
+{
+    Progress.TotalRuns++;
+    Progress.BestDistanceMeters = FMath::Max(Progress.BestDistanceMeters, DistanceMeters);
+    Progress.TotalDistanceMeters += FMath::Max(0.0f, DistanceMeters);
+    Progress.HighScore = FMath::Max(Progress.HighScore, Score);
+    MarkDirty();
+}
+
+void UProgressSaveSubsystem::MarkDirty()
+{
+    bDirty = true;
+}
+
+// ======================================================================
+// Persistence
+// ======================================================================
+
+void UProgressSaveSubsystem::RequestSave()
+{
+    if (!bDirty)
+    {
+        return;
+    }
+
+    // Coalesce: the load or in-flight write completion picks this up
+    if (!bLoaded || bWriteInFlight)
+    {
+        bSaveRequested = true;
+        return;
+    }
+
+    BeginWrite();
+}
+
+USideRunnerSaveGame* UProgressSaveSubsystem::PrepareSaveObject(int32 SlotIndex, int64 Sequence)
+{
+    if (!SlotObjects[SlotIndex])
+    {
+        SlotObjects[SlotIndex] = Cast<USideRunnerSaveGame>(UGameplayStatics::CreateSaveGameObject(USideRunnerSaveGame::StaticClass()));
+        if (!SlotObjects[SlotIndex])
+        {
+            UE_LOG(LogSideRunner, Error, TEXT("ProgressSave: Failed to create save object"));
+            return nullptr;
+        }
+    }
+
+    USideRunnerSaveGame* SaveObject = SlotObjects[SlotIndex];
+    SaveObject->Version = USideRunnerSaveGame::CurrentVersion;
+    SaveObject->Sequence = Sequence;
+    SaveObject->Progress = Progress;
+    SaveObject->Checksum = SaveObject->ComputeChecksum();
+    return SaveObject;
+}
+
+void UProgressSaveSubsystem::BeginWrite()
+{
+    // Always write the slot that does NOT hold the newest save
+    const int32 SlotIndex = NewestSlot == 0 ? 1 : 0;
+
+    USideRunnerSaveGame* SaveObject = PrepareSaveObject(SlotIndex, LastSequence + 1);
+    if (!SaveObject)
+    {
+        return;
+    }
+
+    bDirty = false;
+    bSaveRequested = false;
+    bWriteInFlight = true;
+
+    UGameplayStatics::AsyncSaveGameToSlot(SaveObject, ProgressSaveConstants::SLOT_NAMES[SlotIndex], ProgressSaveConstants::USER_INDEX,
+        FAsyncSaveGameToSlotDelegate::CreateUObject(this, &UProgressSaveSubsystem::HandleSlotSaved));
+}
+
+void UProgressSaveSubsystem::HandleSlotSaved(const FString& SlotName, const int32 UserIndex, bool bSuccess)
+{
+    bWriteInFlight = false;
+
+    const int32 SlotIndex = SlotName == ProgressSaveConstants::SLOT_NAMES[1] ? 1 : 0;
+    if (bSuccess)
+    {
+        NewestSlot = SlotIndex;
+        LastSequence = SlotObjects[SlotIndex] ? SlotObjects[SlotIndex]->Sequence : LastSequence + 1;
+
+#if UE_BUILD_DEVELOPMENT
+        UE_LOG(LogSideRunner, Verbose, TEXT("ProgressSave: Wrote %s (sequence %lld)"), *SlotName, LastSequence);
+#endif
+    }
+    else
+    {
+        // The other slot still holds the previous save; retry with the next request
+        UE_LOG(LogSideRunner, Warning, TEXT("ProgressSave: Failed to write %s"), *SlotName);
+        bDirty = true;
+    }
+
+    // Requests that arrived during the write collapse into one follow-up write
+    if (bSaveRequested && bDirty)
+    {
+        BeginWrite();
+    }
+}
+
+void UProgressSaveSubsystem::HandleSlotLoaded(const FString& SlotName, const int32 UserIndex, USaveGame* LoadedGame)
+{
+    const USideRunnerSaveGame* Save = Cast<USideRunnerSaveGame>(LoadedGame);
+    if (Save && Save->IsValidSave())
+    {
+        if (Save->Sequence > LastSequence)
+        {
+            LastSequence = Save->Sequence;
+            NewestSlot = SlotName == ProgressSaveConstants::SLOT_NAMES[1] ? 1 : 0;
+            LoadedProgress = Save->Progress;
+        }
+    }
+    else if (LoadedGame)
+    {
+        UE_LOG(LogSideRunner, Warning, TEXT("ProgressSave: Ignoring invalid or corrupted slot %s"), *SlotName);
+    }
+
+    if (--PendingLoads > 0)
+    {
+        return;
+    }
+
+    // Changes made while loading are kept on top of the loaded progress
+    FSideRunnerProgress Merged = LoadedProgress;
+    Merged.MergeFrom(Progress);
+    Progress = Merged;
+    bLoaded = true;
+
+    UE_LOG(LogSideRunner, Log, TEXT("ProgressSave: Loaded progress (HighScore=%d, Coins=%d, Runs=%d)"),
+           Progress.HighScore, Progress.PersistentCoins, Progress.TotalRuns);
+
+    OnProgressLoaded.Broadcast(Progress);
+
+    if (bSaveRequested)
+    {
+        RequestSave();
+    }
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "SideRunnerSaveGame.h"
+#include "ProgressSaveSubsystem.generated.h"
+
+class USaveGame;
+
+/** Fired once both save slots have been read (Progress then holds the loaded values). */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnProgressLoaded, const FSideRunnerProgress& /*Progress*/);
+
+/**
+ * Save slot configuration for UProgressSaveSubsystem
+ */
+namespace ProgressSaveConstants
+{
+    /** The two alternating slots (double buffer) */
+    static const TCHAR* const SLOT_NAMES[2] = { TEXT("SideRunnerProgress_A"), TEXT("SideRunnerProgress_B") };
+
+    /** Platform user index for all progress saves */
+    constexpr int32 USER_INDEX = 0;
+}
+
+/**
+ * Owns the player's persistent progress and writes it in the background.
+ *
+ * Gameplay code only updates in-memory state (AddPersistentCoins, SubmitHighScore, RecordRunFinished),
+ * which marks it dirty. RequestSave is called at safe points (milestones, game over) and writes the
+ * dirty state with AsyncSaveGameToSlot. At most one write is in flight; requests made meanwhile are
+ * coalesced into a single follow-up write.
+ *
+ * Writes alternate between two slots, each stamped with a sequence number and checksum, so a write
+ * interrupted by a crash or power loss leaves the previous slot intact. Loading picks the newest
+ * valid slot.
+ *
+ * PERFORMANCE: No save or load ever runs synchronously on the game thread during play; only
+ * Deinitialize flushes synchronously, as the game instance shuts down.
+ */
+UCLASS()
+class SIDERUNNER_API UProgressSaveSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // ======================================================================
+    // Progress Updates (in memory; marks dirty)
+    // ======================================================================
+
+    /** Adds coins to the persistent coin bank. */
+    UFUNCTION(BlueprintCallable, Category = "Save")
+    void AddPersistentCoins(int32 Amount);
+
+    /** Raises the stored high score if Score beats it. */
+    UFUNCTION(BlueprintCallable, Category = "Save")
+    void SubmitHighScore(int32 Score);
+
+    /**
+     * Records a finished run in the lifetime stats and submits its score.
+     *
+     * @param Score - Final score of the run
+     * @param DistanceMeters - Distance the run covered
+     */
+    UFUNCTION(BlueprintCallable, Category = "Save")
+    void RecordRunFinished(int32 Score, float DistanceMeters);
+
+    // ======================================================================
+    // Persistence
+    // ======================================================================
+
+    /**
+     * Writes dirty progress in the background. Cheap to call often: does nothing when clean,
+     * and folds into the pending write when one is already in flight or the load is not done.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Save")
+    void RequestSave();
+
+    /** Returns the current progress (loaded values plus changes since). */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Save")
+    const FSideRunnerProgress& GetProgress() const { return Progress; }
+
+    /** True once both slots have been read. */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Save")
+    bool IsProgressLoaded() const { return bLoaded; }
+
+    /** Broadcast when loading completes. */
+    FOnProgressLoaded OnProgressLoaded;
+
+private:
+    void MarkDirty();
+
+    /** Starts an async write of Progress to the slot after the newest one. */
+    void BeginWrite();
+
+    /** Fills the save object for a slot with the current progress, stamped with Sequence. */
+    USideRunnerSaveGame* PrepareSaveObject(int32 SlotIndex, int64 Sequence);
+
+    void HandleSlotLoaded(const FString& SlotName, const int32 UserIndex, USaveGame* LoadedGame);
+    void HandleSlotSaved(const FString& SlotName, const int32 UserIndex, bool bSuccess);
+
+    /** Current progress */
+    FSideRunnerProgress Progress;
+
+    /** One save object per slot: the object being written is never modified while in flight */
+    UPROPERTY()
+    USideRunnerSaveGame* SlotObjects[2];
+
+    /** Sequence of the newest slot on disk (read or written) */
+    int64 LastSequence = 0;
+
+    /** Slot holding the newest valid save, or INDEX_NONE */
+    int32 NewestSlot = INDEX_NONE;
+
+    /** Newest valid save found while loading */
+    FSideRunnerProgress LoadedProgress;
+
+    int32 PendingLoads = 0;
+    bool bLoaded = false;
+    bool bDirty = false;
+    bool bWriteInFlight = false;
+    bool bSaveRequested = false;
+};
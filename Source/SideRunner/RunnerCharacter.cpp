@@ -13,10 +13,14 @@
 #include "PlayerHealthComponent.h"
 #include "SideRunnerGameInstance.h"
 #include "GameFramework/PlayerStart.h"
-#include "SpawnLevel.h" // For ResetLevelsForRespawn on respawn
+#include "EngineUtils.h"
+#include "SpawnLevel.h" // For WarmRespawn/ResetRun on respawn and restart
 #include "SideRunner.h" // Custom log categories
 #include "EnemyCharacter.h"
 #include "SideRunnerGameMode.h"
+#include "CoinCounter.h"
+#include "CoinPickup.h"
+#include "StatusEffectComponent.h"
 
 // CRITICAL FIX: Comprehensive validation macro for HealthComponent access
 // Prevents access violations by validating component before use
@@ -122,6 +126,8 @@ ARunnerCharacter::ARunnerCharacter()
     HealthComponent = CreateDefaultSubobject<UPlayerHealthComponent>(TEXT("HealthComponent"));
     ensure(HealthComponent); // Debug validation
 
+    StatusEffects = CreateDefaultSubobject<UStatusEffectComponent>(TEXT("StatusEffects"));
+
     // Initialize death processing flag
     bIsProcessingDeath = false;
 
@@ -240,6 +246,16 @@ void ARunnerCharacter::BeginPlay()
 #endif
     }
 
+    if (IsValid(StatusEffects))
+    {
+        StatusEffects->OnEffectApplied.AddDynamic(this, &ARunnerCharacter::HandleStatusEffectApplied);
+        StatusEffects->OnEffectExpired.AddDynamic(this, &ARunnerCharacter::HandleStatusEffectExpired);
+    }
+    if (const UCharacterMovementComponent* Movement = GetCharacterMovement())
+    {
+        BaseWalkSpeed = Movement->MaxWalkSpeed;
+    }
+
     // Register with the GameMode for death delegate binding
     if (ASideRunnerGameMode* GM = Cast<ASideRunnerGameMode>(UGameplayStatics::GetGameMode(this)))
     {
@@ -281,6 +297,12 @@ void ARunnerCharacter::BeginPlay()
     // This ensures character remains locked to the 2.5D plane even if physics tries to push them off
     InitialXPosition = GetActorLocation().X;
     UE_LOG(LogSideRunner, Log, TEXT("2.5D Constraint: Initial X-position locked at %.2f"), InitialXPosition);
+
+    // Announce last, once every component is initialized, so HUD elements can bind without polling
+    if (CachedGameInstance)
+    {
+        CachedGameInstance->RegisterPlayerCharacter(this);
+    }
 }
 
 // Called every frame
@@ -339,11 +361,75 @@ void ARunnerCharacter::Tick(float DeltaTime)
         return;
     }
 
+    if (bMagnetActive)
+    {
+        PullCoinsInMagnetRange();
+    }
+
     // Update animation state and timer
     UpdateAnimationState();
     StateTimer += DeltaTime;
 }
 
+// ======================================================================
+// Status effects
+// ======================================================================
+
+void ARunnerCharacter::HandleStatusEffectApplied(FName Effect, float Duration)
+{
+    RefreshStatusModifiers();
+}
+
+void ARunnerCharacter::HandleStatusEffectExpired(FName Effect)
+{
+    RefreshStatusModifiers();
+}
+
+void ARunnerCharacter::RefreshStatusModifiers()
+{
+    const bool bHasEffects = IsValid(StatusEffects);
+
+    float SpeedScale = 1.0f;
+    if (bHasEffects && StatusEffects->HasEffect(StatusEffectNames::SpeedBoost))
+    {
+        SpeedScale *= SpeedBoostMultiplier;
+    }
+    if (bHasEffects && StatusEffects->HasEffect(StatusEffectNames::Slow))
+    {
+        SpeedScale *= SlowMultiplier;
+    }
+
+    if (UCharacterMovementComponent* Movement = GetCharacterMovement())
+    {
+        Movement->MaxWalkSpeed = BaseWalkSpeed * SpeedScale;
+    }
+
+    bMagnetActive = bHasEffects && StatusEffects->HasEffect(StatusEffectNames::Magnet);
+}
+
+void ARunnerCharacter::PullCoinsInMagnetRange()
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    // PERFORMANCE: One sphere query per frame, only while the magnet is active
+    MagnetOverlaps.Reset();
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(RunnerMagnet), false, this);
+    World->OverlapMultiByObjectType(MagnetOverlaps, GetActorLocation(), FQuat::Identity,
+        FCollisionObjectQueryParams(ECC_WorldDynamic), FCollisionShape::MakeSphere(MagnetRadius), Params);
+
+    for (const FOverlapResult& Overlap : MagnetOverlaps)
+    {
+        if (ACoinPickup* Coin = Cast<ACoinPickup>(Overlap.GetActor()))
+        {
+            Coin->AttractTo(this);
+        }
+    }
+}
+
 // DEPRECATED: Camera positioning now handled by USpringArmComponent
 // Left here for reference - can be removed in future cleanup
 /*
@@ -527,11 +613,8 @@ void ARunnerCharacter::RestartLevel()
 {
     UE_LOG(LogSideRunner, Log, TEXT("RestartLevel called"));
 
-    // CRITICAL FIX: Clean up before level transition
-    CleanupBeforeDestroy();
-
     // CRITICAL FIX: Validate world
-    const UWorld* World = GetWorld();
+    UWorld* World = GetWorld();
     if (!World)
     {
         UE_LOG(LogSideRunner, Error, TEXT("RestartLevel: World is null!"));
@@ -544,6 +627,36 @@ void ARunnerCharacter::RestartLevel()
         CachedGameInstance->ResetGameSession();
     }
 
+    // PERFORMANCE: Soft reset in place — the map, its assets and the actor pools stay loaded
+    CacheRespawnActors(World);
+    if (CachedSpawnLevel.IsValid())
+    {
+        GetWorldTimerManager().ClearTimer(RespawnTimerHandle);
+
+        if (ASideRunnerGameMode* GameMode = World->GetAuthGameMode<ASideRunnerGameMode>())
+        {
+            GameMode->ResetRun();
+        }
+
+        // Coin counter lives on the character or its controller (Blueprint-added)
+        UCoinCounter* CoinCounterComp = FindComponentByClass<UCoinCounter>();
+        if (!CoinCounterComp && GetController())
+        {
+            CoinCounterComp = GetController()->FindComponentByClass<UCoinCounter>();
+        }
+        if (CoinCounterComp)
+        {
+            CoinCounterComp->ResetCoins();
+        }
+
+        RespawnAtPlayerStart(true);
+        return;
+    }
+
+    // No level spawner to rebuild the course in place - fall back to reloading the map
+    // CRITICAL FIX: Clean up before level transition
+    CleanupBeforeDestroy();
+
     // Reload level
     const FString CurrentLevelName = World->GetName();
     UGameplayStatics::OpenLevel(this, FName(*CurrentLevelName));
@@ -829,12 +942,16 @@ float ARunnerCharacter::TakeDamage(float DamageAmount, FDamageEvent const& Damag
 void ARunnerCharacter::RespawnPlayer()
 {
     UE_LOG(LogSideRunner, Log, TEXT("RespawnPlayer called"));
+    RespawnAtPlayerStart(false);
+}
 
+void ARunnerCharacter::RespawnAtPlayerStart(bool bNewRun)
+{
     // CRITICAL FIX: Validate 'this' pointer itself (timer may fire on destroyed object)
     // UE 5.5: Use IsValid() for 'this' pointer validation
     if (!IsValid(this))
     {
-        UE_LOG(LogSideRunner, Error, TEXT("RespawnPlayer: 'this' pointer is invalid!"));
+        UE_LOG(LogSideRunner, Error, TEXT("RespawnAtPlayerStart: 'this' pointer is invalid!"));
         return;
     }
 
@@ -842,7 +959,7 @@ void ARunnerCharacter::RespawnPlayer()
     UWorld* World = GetWorld();
     if (!World)
     {
-        UE_LOG(LogSideRunner, Error, TEXT("RespawnPlayer: World is null!"));
+        UE_LOG(LogSideRunner, Error, TEXT("RespawnAtPlayerStart: World is null!"));
         return;
     }
 
@@ -851,6 +968,14 @@ void ARunnerCharacter::RespawnPlayer()
 
     // CRITICAL FIX: Use validation macro for consistency
     VALIDATE_HEALTH_COMPONENT_VOID();
+
+    // Power-ups don't survive a respawn
+    if (IsValid(StatusEffects))
+    {
+        StatusEffects->ClearEffects();
+    }
+    RefreshStatusModifiers();
+
     HealthComponent->ResetHealth();
 
     // Grant 2 seconds of invulnerability on respawn to prevent instant death
@@ -882,18 +1007,13 @@ void ARunnerCharacter::RespawnPlayer()
     FRotator RespawnRotation = FRotator::ZeroRotator;
 
     // Find PlayerStart for respawn location (known to have valid geometry)
-    TArray<AActor*> PlayerStarts;
-    UGameplayStatics::GetAllActorsOfClass(World, APlayerStart::StaticClass(), PlayerStarts);
+    CacheRespawnActors(World);
 
-    if (PlayerStarts.Num() > 0)
+    if (APlayerStart* PlayerStart = CachedPlayerStart.Get())
     {
-        APlayerStart* PlayerStart = Cast<APlayerStart>(PlayerStarts[0]);
-        if (PlayerStart)
-        {
-            RespawnLocation = PlayerStart->GetActorLocation();
-            RespawnRotation = PlayerStart->GetActorRotation();
-            UE_LOG(LogSideRunner, Log, TEXT("Using PlayerStart location for respawn: %s"), *RespawnLocation.ToString());
-        }
+        RespawnLocation = PlayerStart->GetActorLocation();
+        RespawnRotation = PlayerStart->GetActorRotation();
+        UE_LOG(LogSideRunner, Log, TEXT("Using PlayerStart location for respawn: %s"), *RespawnLocation.ToString());
     }
     else
     {
@@ -916,18 +1036,21 @@ void ARunnerCharacter::RespawnPlayer()
     SetActorLocation(RespawnLocation, false, nullptr, ETeleportType::ResetPhysics);
     SetActorRotation(RespawnRotation);
 
-    // CRITICAL FIX: Reset all level spawners to create fresh levels at player position
-    TArray<AActor*> SpawnLevelActors;
-    UGameplayStatics::GetAllActorsOfClass(World, ASpawnLevel::StaticClass(), SpawnLevelActors);
-    for (AActor* Actor : SpawnLevelActors)
+    // Rebuild the course at the player position, spawning only the chunk under the player this frame.
+    // Respawn keeps chunks already there and replays the rest; a new run starts a fresh course.
+    if (ASpawnLevel* SpawnLevelActor = CachedSpawnLevel.Get())
     {
-        if (ASpawnLevel* SpawnLevelActor = Cast<ASpawnLevel>(Actor))
+        if (bNewRun)
         {
-            SpawnLevelActor->ResetLevelsForRespawn();
+            SpawnLevelActor->ResetRun(RespawnLocation);
+        }
+        else
+        {
+            SpawnLevelActor->WarmRespawn(RespawnLocation);
         }
     }
 
-    // RESPAWN FIX: Restore movement now that levels are spawned beneath the player
+    // RESPAWN FIX: Restore movement now that a level is spawned beneath the player
     if (MoveComp)
     {
         MoveComp->GravityScale = 2.5f;  // Matches constructor value (line 100)
@@ -940,11 +1063,29 @@ void ARunnerCharacter::RespawnPlayer()
     {
         CachedGameInstance->SetRespawnLocation(RespawnLocation);
         CachedGameInstance->InitializeDistanceTracking(RespawnLocation.Y);
+
+        // HUD elements rebind (or refresh) immediately instead of polling for the pawn
+        CachedGameInstance->RegisterPlayerCharacter(this);
     }
 
     UE_LOG(LogSideRunner, Log, TEXT("Player respawned at: %s"), *RespawnLocation.ToString());
 }
 
+void ARunnerCharacter::CacheRespawnActors(UWorld* World)
+{
+    if (!CachedPlayerStart.IsValid())
+    {
+        TActorIterator<APlayerStart> It(World);
+        CachedPlayerStart = It ? *It : nullptr;
+    }
+
+    if (!CachedSpawnLevel.IsValid())
+    {
+        TActorIterator<ASpawnLevel> It(World);
+        CachedSpawnLevel = It ? *It : nullptr;
+    }
+}
+
 void ARunnerCharacter::CleanupBeforeDestroy()
 {
     // CRITICAL FIX: Clear all active timers to prevent callbacks on destroyed object
@@ -965,6 +1106,12 @@ void ARunnerCharacter::CleanupBeforeDestroy()
         HealthComponent->OnPlayerDeath.RemoveAll(this);
     }
 
+    if (IsValid(StatusEffects))
+    {
+        StatusEffects->OnEffectApplied.RemoveAll(this);
+        StatusEffects->OnEffectExpired.RemoveAll(this);
+    }
+
     UE_LOG(LogSideRunner, Verbose, TEXT("RunnerCharacter cleanup completed"));
 }
 
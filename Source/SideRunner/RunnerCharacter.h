@@ -2,12 +2,14 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
+#include "Engine/OverlapResult.h"
 #include "PlayerHealthComponent.h"
 #include "RunnerCharacter.generated.h"
 
 // Forward declarations for better compilation performance
 class AWallSpike;
 class ASpikes;
+class UStatusEffectComponent;
 
 // Define character animation states
 UENUM(BlueprintType)
@@ -92,6 +94,22 @@ public:
     // PERFORMANCE: Health System
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Health")
     UPlayerHealthComponent* HealthComponent;
+
+    // PERFORMANCE: Timed power-ups (invincibility, magnet, speed boost, slow), expired by the shared timing wheel
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Status Effects")
+    UStatusEffectComponent* StatusEffects;
+
+    /** Walk speed multiplier while the SpeedBoost effect is active */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Status Effects", meta = (ClampMin = "1.0", ClampMax = "3.0"))
+    float SpeedBoostMultiplier = 1.5f;
+
+    /** Walk speed multiplier while the Slow effect is active */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Status Effects", meta = (ClampMin = "0.1", ClampMax = "1.0"))
+    float SlowMultiplier = 0.6f;
+
+    /** Radius within which coins fly to the runner while the Magnet effect is active */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Status Effects", meta = (ClampMin = "100.0", ClampMax = "2000.0"))
+    float MagnetRadius = 600.0f;
     
     // Blueprint events for health system
     UFUNCTION(BlueprintImplementableEvent, Category = "Health")
@@ -191,6 +209,40 @@ private:
     void HandleWallSpikeOverlap(AWallSpike* WallSpike);
     void HandleRegularSpikeOverlap(ASpikes* RegularSpike);
 
+    // Status effect modifiers, recomputed only when an effect starts or ends
+    UFUNCTION()
+    void HandleStatusEffectApplied(FName Effect, float Duration);
+
+    UFUNCTION()
+    void HandleStatusEffectExpired(FName Effect);
+
+    /** Re-derives walk speed and magnet state from the active effects. */
+    void RefreshStatusModifiers();
+
+    /** Attracts pickup coins within MagnetRadius. */
+    void PullCoinsInMagnetRange();
+
+    /** MaxWalkSpeed with no speed effects applied (captured in BeginPlay) */
+    float BaseWalkSpeed = 600.0f;
+
+    bool bMagnetActive = false;
+
+    // Reused overlap buffer for the magnet query
+    TArray<FOverlapResult> MagnetOverlaps;
+
+    // PERFORMANCE: Respawn targets resolved once instead of scanning the world on every respawn
+    TWeakObjectPtr<class APlayerStart> CachedPlayerStart;
+    TWeakObjectPtr<class ASpawnLevel> CachedSpawnLevel;
+
+    /**
+     * Resets health, input and animation, teleports to the PlayerStart and rebuilds the course there.
+     * @param bNewRun - true for an in-place restart (fresh course), false for a respawn (replays nearby chunks)
+     */
+    void RespawnAtPlayerStart(bool bNewRun);
+
+    /** Looks up whichever of CachedPlayerStart/CachedSpawnLevel is not yet valid. */
+    void CacheRespawnActors(UWorld* World);
+
     // CRITICAL FIX: Timer management for access violation prevention
     /** Timer handle for respawn delay after death - MUST be member variable to prevent stack corruption */
     FTimerHandle RespawnTimerHandle;
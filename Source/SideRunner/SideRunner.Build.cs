@@ -22,7 +22,8 @@ public class SideRunner : ModuleRules
 
         // PERFORMANCE: Private dependencies for specific features
         PrivateDependencyModuleNames.AddRange(new string[] {
-            "AudioMixer"			// For optimized audio
+            "AudioMixer",			// For optimized audio
+            "RenderCore"			// For FlushRenderingCommands (dormancy benchmark)
 		});
 
         // PERFORMANCE: Enable optimizations for shipping builds
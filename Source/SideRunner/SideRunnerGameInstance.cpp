@@ -1,5 +1,7 @@
 #include "SideRunnerGameInstance.h"
 #include "Engine/Engine.h"
+#include "ProgressSaveSubsystem.h"
+#include "RunnerCharacter.h"
 #include "SideRunner.h" // Custom log categories
 
 void USideRunnerGameInstance::Init()
@@ -22,6 +24,12 @@ void USideRunnerGameInstance::Init()
     CurrentLives = MaxLives;
     LastRespawnLocation = FVector::ZeroVector;
 
+    // High score arrives from the async save load
+    if (UProgressSaveSubsystem* SaveService = GetSaveService())
+    {
+        SaveService->OnProgressLoaded.AddUObject(this, &USideRunnerGameInstance::HandleProgressLoaded);
+    }
+
     UE_LOG(LogSideRunnerScoring, Log, TEXT("SideRunnerGameInstance initialized - Win distance: %.1f meters, Lives: %d"), WinDistance, MaxLives);
 }
 
@@ -161,6 +169,13 @@ void USideRunnerGameInstance::TriggerGameOver(bool bWon)
     // Update high score
     UpdateHighScore();
 
+    // Game over is a safe point: record the run and write progress in the background
+    if (UProgressSaveSubsystem* SaveService = GetSaveService())
+    {
+        SaveService->RecordRunFinished(CurrentScore, DistanceTraveled / SideRunnerGameInstanceConstants::METERS_TO_UNREAL_UNITS);
+        SaveService->RequestSave();
+    }
+
     // Broadcast appropriate event
     if (bWon)
     {
@@ -262,6 +277,19 @@ void USideRunnerGameInstance::SetRespawnLocation(const FVector& RespawnLocation)
     UE_LOG(LogSideRunner, VeryVerbose, TEXT("Respawn location set to: %s"), *RespawnLocation.ToString());
 }
 
+void USideRunnerGameInstance::RegisterPlayerCharacter(ARunnerCharacter* PlayerCharacter)
+{
+    if (!PlayerCharacter)
+    {
+        return;
+    }
+
+    RegisteredPlayerCharacter = PlayerCharacter;
+    OnPlayerCharacterReady.Broadcast(PlayerCharacter);
+
+    UE_LOG(LogSideRunner, Log, TEXT("Player character registered: %s"), *PlayerCharacter->GetName());
+}
+
 void USideRunnerGameInstance::InitializeDistanceTracking(float StartingYPosition)
 {
     LastRecordedY = StartingYPosition;
@@ -287,7 +315,25 @@ void USideRunnerGameInstance::CheckMilestone()
         LastMilestone = CurrentMilestone;
         OnMilestoneReached.Broadcast(LastMilestone);
 
+        // Milestones are a safe point: keep the best score so far even if the run never finishes
+        if (UProgressSaveSubsystem* SaveService = GetSaveService())
+        {
+            SaveService->SubmitHighScore(CurrentScore);
+            SaveService->RequestSave();
+        }
+
         UE_LOG(LogSideRunnerScoring, Log, TEXT("Milestone reached: %d (Distance: %.0fm)"),
                LastMilestone, DistanceMeters);
     }
 }
+
+UProgressSaveSubsystem* USideRunnerGameInstance::GetSaveService() const
+{
+    return GetSubsystem<UProgressSaveSubsystem>();
+}
+
+void USideRunnerGameInstance::HandleProgressLoaded(const FSideRunnerProgress& Progress)
+{
+    HighScore = FMath::Max(HighScore, Progress.HighScore);
+    UE_LOG(LogSideRunnerScoring, Log, TEXT("High score loaded: %d"), HighScore);
+}
@@ -4,6 +4,8 @@
 #include "Engine/GameInstance.h"
 #include "SideRunnerGameInstance.generated.h"
 
+class ARunnerCharacter;
+
 /**
  * Delegate fired when the player's score changes
  * @param NewScore - The updated total score
@@ -39,6 +41,12 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnMilestoneReached, int32, Mileston
  */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnLivesUpdated, int32, CurrentLives, int32, MaxLives);
 
+/**
+ * Delegate fired when the player character is ready (finished BeginPlay or respawned)
+ * @param PlayerCharacter - The registered character; its components are initialized
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPlayerCharacterReady, ARunnerCharacter*, PlayerCharacter);
+
 /**
  * Performance constants for game instance calculations
  * Centralized to ensure consistency and improve maintainability
@@ -72,7 +80,7 @@ namespace SideRunnerGameInstanceConstants
  * - Coin bonus system (configurable points per coin)
  * - Enemy kill bonuses (configurable points per kill)
  * - Win condition at configurable distance (default: 5000m)
- * - High score tracking across game sessions
+ * - High score tracking across game sessions (persisted by UProgressSaveSubsystem)
  * - Event delegates for UI integration
  *
  * Performance Optimizations:
@@ -262,6 +270,27 @@ public:
     UFUNCTION(BlueprintPure, Category = "Lives")
     FVector GetRespawnLocation() const { return LastRespawnLocation; }
 
+    // ======================================================================
+    // Player Registration
+    // ======================================================================
+
+    /**
+     * Records the player character and broadcasts OnPlayerCharacterReady.
+     * Called by ARunnerCharacter at the end of BeginPlay and after every respawn.
+     *
+     * @param PlayerCharacter - The ready character
+     */
+    void RegisterPlayerCharacter(ARunnerCharacter* PlayerCharacter);
+
+    /**
+     * Returns the last registered player character, if it still exists.
+     * Lets listeners created after registration bind immediately.
+     *
+     * @return Registered character or nullptr
+     */
+    UFUNCTION(BlueprintPure, Category = "Player")
+    ARunnerCharacter* GetPlayerCharacter() const { return RegisteredPlayerCharacter.Get(); }
+
     /**
      * Initializes the distance tracking from player's starting position.
      * Should be called once at game start to ensure accurate score calculation.
@@ -302,6 +331,10 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Events")
     FOnMilestoneReached OnMilestoneReached;
 
+    /** Broadcast when the player character is ready or respawned - bind HUD elements to its components */
+    UPROPERTY(BlueprintAssignable, Category = "Events")
+    FOnPlayerCharacterReady OnPlayerCharacterReady;
+
 protected:
     // ======================================================================
     // Scoring State
@@ -357,9 +390,18 @@ private:
     /** Last milestone reached (floor(DistanceMeters / 1000)) */
     int32 LastMilestone;
 
+    /** Character passed to the last RegisterPlayerCharacter (weak: the world owns it) */
+    TWeakObjectPtr<ARunnerCharacter> RegisteredPlayerCharacter;
+
     /** Checks and fires milestone delegate if a new 1000m threshold is crossed. */
     void CheckMilestone();
 
+    /** Adopts the saved high score once UProgressSaveSubsystem finishes loading. */
+    void HandleProgressLoaded(const struct FSideRunnerProgress& Progress);
+
+    /** Returns the progress save service, or nullptr. */
+    class UProgressSaveSubsystem* GetSaveService() const;
+
     // ======================================================================
     // Helper Functions
     // ======================================================================
@@ -61,6 +61,19 @@ int32 ASideRunnerGameMode::GetHighScore() const
     return HighScore;
 }
 
+void ASideRunnerGameMode::ResetRun()
+{
+    Score = 0;
+
+    if (CurrentWidget)
+    {
+        CurrentWidget->RemoveFromParent();
+        CurrentWidget = nullptr;
+    }
+
+    UE_LOG(LogSideRunner, Log, TEXT("[GameMode] Run reset — High Score: %d"), HighScore);
+}
+
 void ASideRunnerGameMode::OnPlayerDeath()
 {
     UE_LOG(LogSideRunner, Log, TEXT("[GameMode] Player died — Score: %d"), Score);
@@ -63,6 +63,10 @@ public:
     UFUNCTION(BlueprintPure, Category = "Game|Score")
     int32 GetHighScore() const;
 
+    /** Clears per-run state (score, Game Over widget) for an in-place restart. High score is kept. */
+    UFUNCTION(BlueprintCallable, Category = "Game|Score")
+    void ResetRun();
+
 protected:
     // ── AGameModeBase overrides ──────────────────────────────────────────────
 
@@ -5,7 +5,10 @@
 #include "SideRunner.h" // Custom log categories
 #include "RunnerCharacter.h"
 #include "PlayerHealthComponent.h"
+#include "BaseLevel.h"
 #include "Engine/Engine.h"
+#include "EngineUtils.h"
+#include "RenderingThread.h"
 
 ASideRunnerPlayerController::ASideRunnerPlayerController()
 {
@@ -199,6 +202,79 @@ void ASideRunnerPlayerController::KillPlayer()
 		UE_LOG(LogSideRunner, Error, TEXT("DEBUG: Cannot kill player - HealthComponent is invalid or not initialized!"));
 	}
 }
+
+void ASideRunnerPlayerController::BenchmarkChunkDormancy(int32 Iterations)
+{
+	Iterations = Iterations > 0 ? Iterations : 10;
+
+	// Only benchmark awake chunks; each wake restores the state captured by its sleep
+	TArray<ABaseLevel*> Levels;
+	for (TActorIterator<ABaseLevel> It(GetWorld()); It; ++It)
+	{
+		if (!It->IsLevelDormant() && It->GetLevelActors().Num() > 0)
+		{
+			Levels.Add(*It);
+		}
+	}
+
+	if (Levels.Num() == 0)
+	{
+		UE_LOG(LogSideRunner, Warning, TEXT("DEBUG: BenchmarkChunkDormancy - no populated levels to measure"));
+		return;
+	}
+
+	int32 TotalActors = 0;
+	for (const ABaseLevel* Level : Levels)
+	{
+		TotalActors += Level->GetLevelActors().Num();
+	}
+
+	// Render state changes are only applied at end of frame: push them and wait for the render thread
+	// inside the timed section, so proxy rebuilds are counted as if sleep and wake were frames apart
+	UWorld* World = GetWorld();
+	auto FlushFrameUpdates = [World]()
+	{
+		World->SendAllEndOfFrameUpdates();
+		FlushRenderingCommands();
+	};
+	FlushFrameUpdates();
+
+	TArray<FActorDormancyState> SavedStates;
+	for (const EChunkDormancyMode Mode : { EChunkDormancyMode::PerActor, EChunkDormancyMode::Bulk })
+	{
+		double SleepSeconds = 0.0;
+		double WakeSeconds = 0.0;
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			for (const ABaseLevel* Level : Levels)
+			{
+				double StartTime = FPlatformTime::Seconds();
+				ABaseLevel::SleepActors(Level->GetLevelActors(), Mode, SavedStates);
+				FlushFrameUpdates();
+				SleepSeconds += FPlatformTime::Seconds() - StartTime;
+
+				StartTime = FPlatformTime::Seconds();
+				ABaseLevel::WakeActors(SavedStates);
+				FlushFrameUpdates();
+				WakeSeconds += FPlatformTime::Seconds() - StartTime;
+			}
+		}
+		const double NumCycles = static_cast<double>(Iterations * Levels.Num());
+		const double SleepMs = SleepSeconds * 1000.0 / NumCycles;
+		const double WakeMs = WakeSeconds * 1000.0 / NumCycles;
+
+		const FString Result = FString::Printf(TEXT("DEBUG: Dormancy %s: %.3f ms per chunk (sleep %.3f + wake %.3f, incl. render updates; %d chunks, %.1f actors/chunk, %d iterations)"),
+			*UEnum::GetValueAsString(Mode), SleepMs + WakeMs, SleepMs, WakeMs, Levels.Num(),
+			static_cast<float>(TotalActors) / Levels.Num(), Iterations);
+
+		UE_LOG(LogSideRunner, Warning, TEXT("%s"), *Result);
+
+		if (GEngine)
+		{
+			GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Cyan, Result);
+		}
+	}
+}
 #else // UE_BUILD_SHIPPING
 // Provide empty stub implementations for shipping builds
 void ASideRunnerPlayerController::DebugTriggerGameOver() {}
@@ -206,4 +282,5 @@ void ASideRunnerPlayerController::DebugSetScore(int32 NewScore) {}
 void ASideRunnerPlayerController::DebugAddLives(int32 LivestoAdd) {}
 void ASideRunnerPlayerController::TeleportToDistance(float DistanceMeters) {}
 void ASideRunnerPlayerController::KillPlayer() {}
+void ASideRunnerPlayerController::BenchmarkChunkDormancy(int32 Iterations) {}
 #endif
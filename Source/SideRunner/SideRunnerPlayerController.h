@@ -71,6 +71,17 @@ public:
 	UFUNCTION(Exec, Category = "Debug")
 	void KillPlayer();
 
+	/**
+	 * Measures per-chunk sleep and wake cost of every live level in both dormancy modes,
+	 * including the end-of-frame render state updates each one causes.
+	 * Usage: BenchmarkChunkDormancy 20
+	 * Headless: -game -nullrhi -ExecCmds="BenchmarkChunkDormancy 20"
+	 * @param Iterations - Sleep/wake cycles per chunk and mode (defaults to 10 when 0)
+	 * @note Only functional in non-shipping builds
+	 */
+	UFUNCTION(Exec, Category = "Debug")
+	void BenchmarkChunkDormancy(int32 Iterations);
+
 private:
 	/** Cached reference to game instance for debug commands */
 	UPROPERTY()
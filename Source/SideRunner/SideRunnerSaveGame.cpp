@@ -0,0 +1,15 @@
+#include "SideRunnerSaveGame.h"
+#include "Misc/Crc.h"
+
+uint32 USideRunnerSaveGame::ComputeChecksum() const
+{
+    // Field by field, so struct padding never enters the checksum
+    uint32 Crc = FCrc::MemCrc32(&Version, sizeof(Version));
+    Crc = FCrc::MemCrc32(&Sequence, sizeof(Sequence), Crc);
+    Crc = FCrc::MemCrc32(&Progress.PersistentCoins, sizeof(Progress.PersistentCoins), Crc);
+    Crc = FCrc::MemCrc32(&Progress.HighScore, sizeof(Progress.HighScore), Crc);
+    Crc = FCrc::MemCrc32(&Progress.TotalRuns, sizeof(Progress.TotalRuns), Crc);
+    Crc = FCrc::MemCrc32(&Progress.BestDistanceMeters, sizeof(Progress.BestDistanceMeters), Crc);
+    Crc = FCrc::MemCrc32(&Progress.TotalDistanceMeters, sizeof(Progress.TotalDistanceMeters), Crc);
+    return Crc;
+}
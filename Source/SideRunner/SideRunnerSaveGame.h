@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/SaveGame.h"
+#include "SideRunnerSaveGame.generated.h"
+
+/**
+ * Progress that persists between sessions: persistent coins, high score and lifetime run stats.
+ */
+USTRUCT(BlueprintType)
+struct FSideRunnerProgress
+{
+    GENERATED_BODY()
+
+    /** Coins banked across sessions (UCoinCounter persistent coins) */
+    UPROPERTY(BlueprintReadOnly, Category = "Progress")
+    int32 PersistentCoins = 0;
+
+    /** Best score of any finished or in-progress run */
+    UPROPERTY(BlueprintReadOnly, Category = "Progress")
+    int32 HighScore = 0;
+
+    /** Runs that reached game over */
+    UPROPERTY(BlueprintReadOnly, Category = "Progress")
+    int32 TotalRuns = 0;
+
+    /** Longest run in meters */
+    UPROPERTY(BlueprintReadOnly, Category = "Progress")
+    float BestDistanceMeters = 0.0f;
+
+    /** Meters run over all finished runs */
+    UPROPERTY(BlueprintReadOnly, Category = "Progress")
+    float TotalDistanceMeters = 0.0f;
+
+    /**
+     * Folds another progress record into this one (maxima for bests, sums for totals).
+     * Used to combine state gathered before the save finished loading with the loaded save.
+     */
+    void MergeFrom(const FSideRunnerProgress& Other)
+    {
+        PersistentCoins += Other.PersistentCoins;
+        HighScore = FMath::Max(HighScore, Other.HighScore);
+        TotalRuns += Other.TotalRuns;
+        BestDistanceMeters = FMath::Max(BestDistanceMeters, Other.BestDistanceMeters);
+        TotalDistanceMeters += Other.TotalDistanceMeters;
+    }
+};
+
+/**
+ * One save slot written by UProgressSaveSubsystem. Two slots are written alternately; the
+ * sequence number picks the newest and the checksum rejects a torn or corrupted copy.
+ */
+UCLASS()
+class SIDERUNNER_API USideRunnerSaveGame : public USaveGame
+{
+    GENERATED_BODY()
+
+public:
+    /** Save format version, bumped when fields change meaning */
+    static constexpr int32 CurrentVersion = 1;
+
+    UPROPERTY()
+    int32 Version = CurrentVersion;
+
+    /** Increases with every write; the higher of two valid slots is the newest */
+    UPROPERTY()
+    int64 Sequence = 0;
+
+    UPROPERTY()
+    FSideRunnerProgress Progress;
+
+    /** ComputeChecksum() at the time of writing */
+    UPROPERTY()
+    uint32 Checksum = 0;
+
+    /** Returns the checksum of Version, Sequence and Progress. */
+    uint32 ComputeChecksum() const;
+
+    /** True if the slot was written by a compatible build and its checksum matches. */
+    bool IsValidSave() const { return Version == CurrentVersion && Checksum == ComputeChecksum(); }
+};
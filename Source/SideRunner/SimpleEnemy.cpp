@@ -247,6 +247,13 @@ void ASimpleEnemy::CleanupIfBehindPlayer()
 	// Destroy if enemy is cleanup distance behind player
 	if (EnemyX < (PlayerX - CleanupDistance))
 	{
+		// Pooled: just stop simulating - the owning chunk returns us to the pool
+		if (bManagedByPool)
+		{
+			SetActorTickEnabled(false);
+			return;
+		}
+
 		// Safe destruction (removes from world, triggers garbage collection)
 		Destroy();
 
@@ -257,6 +264,50 @@ void ASimpleEnemy::CleanupIfBehindPlayer()
 	}
 }
 
+/**
+ * ResetForReuse - Re-arms a pooled enemy at its new placement.
+ *
+ * Pool Flow:
+ * 1. UProceduralLevelBuilder moves the actor and wakes it
+ * 2. This resets patrol origin/direction and the damage cooldown
+ * 3. DeactivateForPool() clears timers when the chunk is recycled
+ *
+ * @param InPatrolDistance Patrol distance for this placement (<= 0 keeps the current value)
+ */
+void ASimpleEnemy::ResetForReuse(float InPatrolDistance)
+{
+	bManagedByPool = true;
+
+	// Patrol restarts from the new placement
+	StartLocation = GetActorLocation();
+	PatrolDirection = 1;
+	if (InPatrolDistance > 0.0f)
+	{
+		PatrolDistance = InPatrolDistance;
+	}
+
+	// Clear any cooldown carried over from the previous placement
+	bHasDealtDamage = false;
+	GetWorldTimerManager().ClearTimer(DamageCooldownTimer);
+
+	// Player may have been replaced since BeginPlay (respawn)
+	if (!IsValid(PlayerRef))
+	{
+		PlayerRef = Cast<ARunnerCharacter>(UGameplayStatics::GetPlayerCharacter(GetWorld(), 0));
+	}
+
+	SetActorTickEnabled(true);
+}
+
+/**
+ * DeactivateForPool - Stops timers before the enemy sleeps in a pool.
+ */
+void ASimpleEnemy::DeactivateForPool()
+{
+	GetWorldTimerManager().ClearTimer(DamageCooldownTimer);
+	bHasDealtDamage = false;
+}
+
 /**
  * OnOverlapBegin - Handles collision with player for damage dealing.
  *
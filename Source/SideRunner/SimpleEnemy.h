@@ -152,6 +152,31 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Enemy|Combat")
 	bool HasRecentlyDealtDamage() const { return bHasDealtDamage; }
 
+	// ========================================
+	// POOLING
+	// ========================================
+
+	/**
+	 * Prepares a pooled enemy for a new placement at its current location.
+	 * Called by UProceduralLevelBuilder on every placement (fresh or reused).
+	 *
+	 * Resets:
+	 * - Patrol origin (current location) and direction
+	 * - Damage cooldown flag and timer
+	 * - Player reference (re-acquired if stale)
+	 *
+	 * Marks the enemy as pool-managed: it no longer destroys itself when behind the player.
+	 *
+	 * @param InPatrolDistance Patrol distance for this placement (<= 0 keeps the current value)
+	 */
+	void ResetForReuse(float InPatrolDistance);
+
+	/**
+	 * Stops pending timers before the enemy goes dormant in a pool.
+	 * Dormancy disables tick but not timers.
+	 */
+	void DeactivateForPool();
+
 protected:
 	// ========================================
 	// MOVEMENT IMPLEMENTATION
@@ -173,6 +198,7 @@ protected:
 
 	/**
 	 * Destroys enemy if it falls too far behind player.
+	 * Pool-managed enemies stop ticking instead; their chunk returns them to the pool.
 	 *
 	 * Purpose: Performance optimization
 	 * - Prevents accumulation of off-screen enemies
@@ -255,4 +281,10 @@ private:
 	 * Allows lambda-based timer callback for clean cooldown logic.
 	 */
 	FTimerHandle DamageCooldownTimer;
+
+	/**
+	 * True once placed by UProceduralLevelBuilder.
+	 * Pool-managed enemies are recycled with their chunk instead of destroying themselves.
+	 */
+	bool bManagedByPool = false;
 };
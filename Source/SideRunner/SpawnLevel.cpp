@@ -3,11 +3,13 @@
 #include "ProceduralLevelBuilder.h"
 #include "DifficultyScaler.h"
 #include "SideRunnerGameInstance.h"
+#include "CoinPoolSubsystem.h"
+#include "CoinPickup.h"
 #include "SideRunner.h" // Custom log categories
 #include "Engine/World.h"
 #include "Components/BoxComponent.h"
-#include "TimerManager.h"
 #include "Kismet/GameplayStatics.h"
+#include "Algo/BinarySearch.h"
 
 namespace SpawnLevelConstants
 {
@@ -16,6 +18,9 @@ namespace SpawnLevelConstants
 
     /** Half-extent height (Z) for procedural level trigger boxes. */
     constexpr float TRIGGER_HALF_HEIGHT = 500.0f;
+
+    /** Number of chunks spawned on begin play and after a respawn. */
+    constexpr int32 INITIAL_LEVEL_COUNT = 4;
 }
 
 // Sets default values
@@ -41,6 +46,9 @@ void ASpawnLevel::BeginPlay()
 {
     Super::BeginPlay();
 
+    // Size the chunk ring once; spawning never grows it
+    LevelList.Reset(MaxActiveLevels + 1);
+
     // Cache game instance for distance queries
     CachedGameInstance = Cast<USideRunnerGameInstance>(
         UGameplayStatics::GetGameInstance(this));
@@ -67,16 +75,15 @@ void ASpawnLevel::BeginPlay()
 
 void ASpawnLevel::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    // Clear all pending timers
-    for (FTimerHandle& TimerHandle : PendingDestroyTimers)
-    {
-        GetWorld()->GetTimerManager().ClearTimer(TimerHandle);
-    }
-    PendingDestroyTimers.Empty();
+    // Drop queued recycles — the world is tearing down and will destroy the levels itself
+    PendingRecycles.Empty();
+    PendingWarmSpawns = 0;
+    RunHistory.Empty();
 
     // Unbind delegates from all remaining levels
-    for (ABaseLevel* Level : LevelList)
+    for (int32 i = 0; i < LevelList.Num(); ++i)
     {
+        ABaseLevel* Level = LevelList[i].Level.Get();
         if (IsValid(Level) && Level->GetTrigger())
         {
             Level->GetTrigger()->OnComponentBeginOverlap.RemoveDynamic(this, &ASpawnLevel::OnOverlapBegin);
@@ -84,10 +91,11 @@ void ASpawnLevel::EndPlay(const EEndPlayReason::Type EndPlayReason)
     }
     LevelList.Empty();
 
-    // Clear object pools
+    // Clear object pools and cached layouts
     if (ProceduralBuilder)
     {
         ProceduralBuilder->ClearPools();
+        ProceduralBuilder->ClearLayoutCache();
     }
 
     Super::EndPlay(EndPlayReason);
@@ -118,6 +126,22 @@ void ASpawnLevel::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
 
+    // Release retired levels whose delay has elapsed (bounded per frame)
+    ProcessPendingRecycles();
+
+    // Advance every moving platform in one batch (platforms don't tick)
+    if (ProceduralBuilder)
+    {
+        ProceduralBuilder->UpdateMovingPlatforms(GetWorld()->GetTimeSeconds());
+    }
+
+    // Finish the initial set after a warm respawn, one chunk per frame
+    if (PendingWarmSpawns > 0)
+    {
+        PendingWarmSpawns--;
+        SpawnLevel(false);
+    }
+
     // Re-acquire player reference if invalid (handles respawn scenarios)
     if (!PlayerWeakPtr.IsValid())
     {
@@ -129,6 +153,11 @@ void ASpawnLevel::Tick(float DeltaTime)
             SpawnInitialLevels(FVector(0.0f, PlayerLoc.Y, 0.0f));
         }
     }
+
+    if (bUseDistanceStreaming)
+    {
+        UpdateDistanceStreaming();
+    }
 }
 
 void ASpawnLevel::SpawnInitialLevels(const FVector& StartPosition)
@@ -137,7 +166,7 @@ void ASpawnLevel::SpawnInitialLevels(const FVector& StartPosition)
     {
         // Store position so SpawnLevel(true) uses it for the first segment
         FirstLevelSpawnPosition = StartPosition;
-        for (int32 i = 0; i < 4; ++i)
+        for (int32 i = 0; i < SpawnLevelConstants::INITIAL_LEVEL_COUNT; ++i)
         {
             SpawnLevel(i == 0);
         }
@@ -153,33 +182,32 @@ void ASpawnLevel::SpawnLevel(bool IsFirst)
     FVector NewSpawnLocation = FirstLevelSpawnPosition;
     FRotator NewSpawnRotation = FRotator(0, 90, 0);
 
-    if (!IsFirst && LevelList.Num() > 0)
+    if (!IsFirst)
     {
-        // Find the last valid level in the list
-        ABaseLevel* LastLevel = nullptr;
-        for (int32 i = LevelList.Num() - 1; i >= 0; --i)
+        // The newest record already knows where it ends — no need for the level actor to still be alive
+        if (!LevelList.IsEmpty())
         {
-            if (IsValid(LevelList[i]))
-            {
-                LastLevel = LevelList[i];
-                break;
-            }
-            else
-            {
-                // Remove stale reference
-                UE_LOG(LogSideRunner, Warning, TEXT("Removing invalid level reference at index %d"), i);
-                LevelList.RemoveAt(i);
-            }
+            NewSpawnLocation = LevelList.Back().EndLocation;
         }
+        else
+        {
+            UE_LOG(LogSideRunner, Warning, TEXT("No valid last level found - using default spawn location"));
+        }
+    }
 
-        if (LastLevel && LastLevel->GetSpawnLocation())
+    // Replaying the recorded course after a respawn: same chunk type, class and seed
+    if (RunHistory.IsValidIndex(NextChunkOrdinal))
+    {
+        const FLevelChunkRecord Replay = RunHistory[NextChunkOrdinal];
+        if (Replay.IsProcedural())
         {
-            NewSpawnLocation = LastLevel->GetSpawnLocation()->GetComponentTransform().GetTranslation();
+            SpawnProceduralLevel(NewSpawnLocation, NewSpawnRotation, &Replay);
         }
         else
         {
-            UE_LOG(LogSideRunner, Warning, TEXT("No valid last level found - using default spawn location"));
+            SpawnHandcraftedLevel(NewSpawnLocation, NewSpawnRotation, &Replay);
         }
+        return;
     }
 
     // Decide: procedural or handcrafted?
@@ -197,13 +225,14 @@ void ASpawnLevel::SpawnLevel(bool IsFirst)
 // Handcrafted Spawn Path (original behavior preserved)
 // ======================================================================
 
-void ASpawnLevel::SpawnHandcraftedLevel(const FVector& SpawnPos, const FRotator& SpawnRot)
+void ASpawnLevel::SpawnHandcraftedLevel(const FVector& SpawnPos, const FRotator& SpawnRot, const FLevelChunkRecord* Replay)
 {
-    int32 RandomLevel = FMath::RandRange(1, 6);
-    TSubclassOf<ABaseLevel> LevelClass = nullptr;
+    TSubclassOf<ABaseLevel> LevelClass = Replay ? Replay->LevelClass : nullptr;
 
+    const int32 RandomLevel = LevelClass ? 0 : FMath::RandRange(1, 6);
     switch (RandomLevel)
     {
+    case 0: break; // Replaying a recorded level
     case 1: LevelClass = Level1; break;
     case 2: LevelClass = Level2; break;
     case 3: LevelClass = Level3; break;
@@ -218,16 +247,31 @@ void ASpawnLevel::SpawnHandcraftedLevel(const FVector& SpawnPos, const FRotator&
         ABaseLevel* NewLevel = GetWorld()->SpawnActor<ABaseLevel>(LevelClass, SpawnPos, SpawnRot, FActorSpawnParameters());
         if (NewLevel)
         {
-            if (NewLevel->GetTrigger())
-            {
-                NewLevel->GetTrigger()->OnComponentBeginOverlap.AddDynamic(this, &ASpawnLevel::OnOverlapBegin);
-            }
-            LevelList.Add(NewLevel);
+            ConfigureLevelTrigger(NewLevel);
 
-            if (LevelList.Num() > MaxActiveLevels)
+            // Register the level's coins like a procedural chunk, so the registry is the only coin total.
+            // A replay reuses its key and is not counted twice.
+            const int32 CoinRegistryKey = Replay ? Replay->CoinRegistryKey : NextProceduralChunkIndex++;
+            if (UCoinPoolSubsystem* CoinPool = GetWorld()->GetSubsystem<UCoinPoolSubsystem>())
             {
-                DelayedDestroyOldestLevel();
+                const int32 NumCoins = CountLevelCoins(NewLevel);
+                CoinPool->RegisterChunkCoins(CoinRegistryKey, NumCoins);
+                NewLevel->SetRegisteredCoinCount(NumCoins);
             }
+
+            FLevelChunkRecord Record;
+            Record.Level = NewLevel;
+            Record.StartY = SpawnPos.Y;
+            Record.EndLocation = NewLevel->GetSpawnLocation()
+                ? NewLevel->GetSpawnLocation()->GetComponentLocation()
+                : SpawnPos + FVector(0.0f, NewLevel->GetLevelLength(), 0.0f);
+            Record.EndY = Record.EndLocation.Y;
+            Record.Difficulty = static_cast<float>(NewLevel->GetDifficultyLevel());
+            Record.LevelClass = LevelClass;
+            Record.CoinRegistryKey = CoinRegistryKey;
+            Record.NumActors = NewLevel->GetLevelActors().Num();
+            RecordChunkSpawn(Record, Replay != nullptr);
+            AddChunkRecord(Record);
         }
     }
 }
@@ -236,7 +280,7 @@ void ASpawnLevel::SpawnHandcraftedLevel(const FVector& SpawnPos, const FRotator&
 // Procedural Spawn Path
 // ======================================================================
 
-void ASpawnLevel::SpawnProceduralLevel(const FVector& SpawnPos, const FRotator& SpawnRot)
+void ASpawnLevel::SpawnProceduralLevel(const FVector& SpawnPos, const FRotator& SpawnRot, const FLevelChunkRecord* Replay)
 {
     UWorld* World = GetWorld();
     if (!World || !ProceduralBuilder || !DifficultyScaler)
@@ -257,51 +301,76 @@ void ASpawnLevel::SpawnProceduralLevel(const FVector& SpawnPos, const FRotator&
         return;
     }
 
-    // Calculate difficulty from current distance
-    const float DistanceMeters = GetCurrentDistanceMeters();
-    float Difficulty = DifficultyScaler->GetDifficultyAtDistance(DistanceMeters);
+    float Difficulty = 1.0f;
+    int32 Seed = CurrentSeed;
+    int32 ChunkIndex = INDEX_NONE;
 
-    // Respawn safety buffer: if this is the first level in a fresh set, reduce difficulty
-    if (LevelList.Num() == 0)
+    if (Replay)
     {
-        Difficulty = FMath::Max(1.0f, Difficulty - 2.0f);
-        UE_LOG(LogSideRunner, Log, TEXT("SpawnProceduralLevel: Respawn safety buffer applied (Difficulty=%.1f)"), Difficulty);
+        // Regenerate the recorded chunk exactly as it was first played
+        Difficulty = Replay->Difficulty;
+        Seed = Replay->Seed;
+        ChunkIndex = Replay->ChunkIndex;
+    }
+    else
+    {
+        // Calculate difficulty from current distance
+        const float DistanceMeters = GetCurrentDistanceMeters();
+        Difficulty = DifficultyScaler->GetDifficultyAtDistance(DistanceMeters);
+
+        // Respawn safety buffer: if this is the first level in a fresh set, reduce difficulty
+        if (LevelList.Num() == 0)
+        {
+            Difficulty = FMath::Max(1.0f, Difficulty - 2.0f);
+            UE_LOG(LogSideRunner, Log, TEXT("SpawnProceduralLevel: Respawn safety buffer applied (Difficulty=%.1f)"), Difficulty);
+        }
+
+        ChunkIndex = NextProceduralChunkIndex++;
     }
 
-    // Generate content
-    CurrentSeed++;
-    TArray<AActor*> GeneratedActors = ProceduralBuilder->GenerateLevelContent(
-        World, SpawnPos.Y, Difficulty, CurrentSeed);
+    // Generate content (seed stays fixed; the chunk index is the per-chunk counter).
+    // Layouts come from the builder's LRU cache, so replayed chunks skip layout work.
+    const FChunkLayout Layout = ProceduralBuilder->GetOrGenerateChunkLayout(Difficulty, Seed, ChunkIndex);
+    TArray<AActor*> GeneratedActors = ProceduralBuilder->SpawnChunkLayout(World, Layout, SpawnPos.Y);
 
     // Inject into level
     NewLevel->SetLevelActors(GeneratedActors);
+    NewLevel->SetDormancyMode(ProceduralBuilder->DormancyMode);
     NewLevel->SetLevelLength(ProceduralBuilder->ChunkLength);
     NewLevel->SetDifficultyLevel(FMath::RoundToInt(Difficulty));
+    NewLevel->SetProxyCoinBlock(ProceduralBuilder->SpawnProxyCoins(World, Layout, SpawnPos.Y));
 
     // Configure trigger at chunk start position with extent covering the chunk
     if (UBoxComponent* Trigger = NewLevel->GetTrigger())
     {
         // Set extent to cover chunk dimensions (half-extents: X=width, Y=half chunk length, Z=height)
         Trigger->SetBoxExtent(FVector(SpawnLevelConstants::TRIGGER_HALF_WIDTH, ProceduralBuilder->ChunkLength * 0.5f, SpawnLevelConstants::TRIGGER_HALF_HEIGHT));
-        Trigger->OnComponentBeginOverlap.AddDynamic(this, &ASpawnLevel::OnOverlapBegin);
     }
+    ConfigureLevelTrigger(NewLevel);
 
-    // Configure spawn location marker at end of chunk (start of next)
+    // Configure spawn location marker at end of chunk (start of next).
+    // World-space: the level is yawed 90 degrees, so a relative +Y offset would point along -X.
+    const FVector ChunkEndLocation = SpawnPos + FVector(0.0f, ProceduralBuilder->ChunkLength, 0.0f);
     if (UBoxComponent* SpawnLoc = NewLevel->GetSpawnLocation())
     {
-        SpawnLoc->SetRelativeLocation(FVector(0.0f, ProceduralBuilder->ChunkLength, 0.0f));
+        SpawnLoc->SetWorldLocation(ChunkEndLocation);
     }
 
-    LevelList.Add(NewLevel);
-
-    if (LevelList.Num() > MaxActiveLevels)
-    {
-        DelayedDestroyOldestLevel();
-    }
+    FLevelChunkRecord Record;
+    Record.Level = NewLevel;
+    Record.StartY = SpawnPos.Y;
+    Record.EndY = ChunkEndLocation.Y;
+    Record.EndLocation = ChunkEndLocation;
+    Record.Seed = Seed;
+    Record.ChunkIndex = ChunkIndex;
+    Record.Difficulty = Layout.Difficulty;
+    Record.NumActors = GeneratedActors.Num();
+    RecordChunkSpawn(Record, Replay != nullptr);
+    AddChunkRecord(Record);
 
 #if UE_BUILD_DEVELOPMENT
-    UE_LOG(LogSideRunner, Log, TEXT("SpawnProceduralLevel: Spawned level at Y=%.0f (Difficulty=%.1f, Seed=%d, Actors=%d)"),
-           SpawnPos.Y, Difficulty, CurrentSeed, GeneratedActors.Num());
+    UE_LOG(LogSideRunner, Log, TEXT("SpawnProceduralLevel: Spawned level at Y=%.0f (Difficulty=%.1f, Seed=%d, Chunk=%d, Actors=%d%s)"),
+           SpawnPos.Y, Difficulty, Seed, ChunkIndex, GeneratedActors.Num(), Replay ? TEXT(", replayed") : TEXT(""));
 #endif
 }
 
@@ -358,6 +427,18 @@ void ASpawnLevel::ReturnLevelToPool(ABaseLevel* Level)
     {
         TArray<AActor*> ActorsToPool = Level->CleanupLevelActors();
         ProceduralBuilder->ReturnActorsToPool(ActorsToPool);
+        ProceduralBuilder->ReleaseProxyCoins(Level->GetProxyCoinBlock());
+        Level->SetProxyCoinBlock(INDEX_NONE);
+    }
+
+    // Handcrafted coins leave play with their level (procedural coins are unregistered by the builder)
+    if (Level->GetRegisteredCoinCount() > 0)
+    {
+        if (UCoinPoolSubsystem* CoinPool = GetWorld() ? GetWorld()->GetSubsystem<UCoinPoolSubsystem>() : nullptr)
+        {
+            CoinPool->UnregisterChunkCoins(Level->GetRegisteredCoinCount());
+        }
+        Level->SetRegisteredCoinCount(0);
     }
 
     // Unbind delegate before destruction to prevent stale callbacks
@@ -369,6 +450,169 @@ void ASpawnLevel::ReturnLevelToPool(ABaseLevel* Level)
     Level->Destroy();
 }
 
+// ======================================================================
+// Chunk Ring
+// ======================================================================
+
+void ASpawnLevel::AddChunkRecord(const FLevelChunkRecord& Record)
+{
+    // Capacity tracks MaxActiveLevels (which may be edited at runtime)
+    if (LevelList.Capacity() != MaxActiveLevels + 1 && LevelList.IsEmpty())
+    {
+        LevelList.Reset(MaxActiveLevels + 1);
+    }
+
+    if (LevelList.IsFull())
+    {
+        DelayedDestroyOldestLevel();
+    }
+
+    LevelList.PushBack(Record);
+
+    while (LevelList.Num() > MaxActiveLevels)
+    {
+        DelayedDestroyOldestLevel();
+    }
+}
+
+int32 ASpawnLevel::CountLevelCoins(ABaseLevel* Level)
+{
+    // Blueprint levels place coins as child actors, which are attached to the level
+    TArray<AActor*> Actors;
+    Level->GetAttachedActors(Actors, true, true);
+    Actors.Append(Level->GetLevelActors());
+
+    TArray<const AActor*, TInlineAllocator<32>> Coins;
+    for (const AActor* Actor : Actors)
+    {
+        if (IsValid(Actor) && Actor->IsA<ACoinPickup>())
+        {
+            Coins.AddUnique(Actor);
+        }
+    }
+    return Coins.Num();
+}
+
+void ASpawnLevel::ConfigureLevelTrigger(ABaseLevel* Level)
+{
+    if (!Level || !Level->GetTrigger())
+    {
+        return;
+    }
+
+    if (bUseDistanceStreaming)
+    {
+        // PERFORMANCE: No overlap box per chunk — streaming is driven by recorded chunk bounds
+        Level->SetTriggerEnabled(false);
+    }
+    else
+    {
+        Level->GetTrigger()->OnComponentBeginOverlap.AddDynamic(this, &ASpawnLevel::OnOverlapBegin);
+    }
+}
+
+const FLevelChunkRecord* ASpawnLevel::GetChunkUnderPlayer() const
+{
+    if (!PlayerWeakPtr.IsValid())
+    {
+        return nullptr;
+    }
+
+    const int32 Index = LevelList.FindIndexAtY(PlayerWeakPtr->GetActorLocation().Y);
+    return Index != INDEX_NONE ? &LevelList[Index] : nullptr;
+}
+
+// ======================================================================
+// Respawn Replay
+// ======================================================================
+
+void ASpawnLevel::RecordChunkSpawn(const FLevelChunkRecord& Record, bool bReplayed)
+{
+    if (bReplayed)
+    {
+        RunHistory[NextChunkOrdinal].Level = Record.Level;
+        NextChunkOrdinal++;
+        return;
+    }
+
+    // New chunks always extend the end of the recorded course
+    RunHistory.Add(Record);
+    NextChunkOrdinal = RunHistory.Num();
+}
+
+FVector ASpawnLevel::BeginReplayAtY(float Y)
+{
+    // Course order keeps StartY ascending, so the containing chunk is a binary search away
+    const int32 Ordinal = Algo::UpperBoundBy(RunHistory, Y, &FLevelChunkRecord::StartY) - 1;
+    if (Ordinal >= 0 && Y < RunHistory[Ordinal].EndY)
+    {
+        NextChunkOrdinal = Ordinal;
+        return Ordinal > 0
+            ? RunHistory[Ordinal - 1].EndLocation
+            : FVector(0.0f, RunHistory[0].StartY, 0.0f);
+    }
+
+    // Off the recorded course: start a new one here
+    RunHistory.Reset();
+    NextChunkOrdinal = 0;
+    return FVector(0.0f, Y, 0.0f);
+}
+
+// ======================================================================
+// Distance Streaming
+// ======================================================================
+
+void ASpawnLevel::UpdateDistanceStreaming()
+{
+    if (!PlayerWeakPtr.IsValid() || LevelList.IsEmpty())
+    {
+        return;
+    }
+
+    const float PlayerY = PlayerWeakPtr->GetActorLocation().Y;
+
+    // Spawn ahead until content covers StreamAheadDistance (budgeted per frame).
+    // Never push out the chunk the player is standing on to make room.
+    for (int32 Spawned = 0; Spawned < MaxStreamSpawnsPerFrame; ++Spawned)
+    {
+        const float ContentEndY = LevelList.Back().EndY;
+        if (ContentEndY - PlayerY >= StreamAheadDistance)
+        {
+            break;
+        }
+        if (LevelList.Num() >= MaxActiveLevels && LevelList.Front().EndY >= PlayerY)
+        {
+            break;
+        }
+
+        SpawnLevel(false);
+
+        // Spawn failed (e.g. missing level class) — don't spin
+        if (LevelList.IsEmpty() || LevelList.Back().EndY <= ContentEndY)
+        {
+            break;
+        }
+    }
+
+    // Recycle chunks that are far enough behind the player
+    while (LevelList.Num() > 1 && LevelList.Front().EndY < PlayerY - StreamBehindDistance)
+    {
+        DelayedDestroyOldestLevel();
+    }
+
+    // Replace the trigger overlap event: broadcast when the player crosses into a new chunk
+    const int32 ChunkIndex = LevelList.FindIndexAtY(PlayerY);
+    if (ChunkIndex != INDEX_NONE)
+    {
+        ABaseLevel* CurrentLevel = LevelList[ChunkIndex].Level.Get();
+        if (IsValid(CurrentLevel) && CurrentLevel != LastEnteredLevel.Get())
+        {
+            LastEnteredLevel = CurrentLevel;
+            CurrentLevel->OnLevelTriggered.Broadcast(CurrentLevel);
+        }
+    }
+}
+
 // ======================================================================
 // Level Destruction
 // ======================================================================
@@ -380,28 +624,47 @@ void ASpawnLevel::DelayedDestroyOldestLevel()
         return;
     }
 
-    // Capture the level to destroy and remove from array immediately
-    TWeakObjectPtr<ABaseLevel> LevelToDestroy = LevelList[0];
-    LevelList.RemoveAt(0);
+    // Retire the oldest level now; it is returned to the pool once its delay elapses
+    FPendingRecycle Recycle;
+    Recycle.Level = LevelList.PopFront().Level;
+    Recycle.ReleaseTime = GetWorld()->GetTimeSeconds() + LevelDestroyDelay;
 
-    FTimerHandle NewTimerHandle;
-    FTimerDelegate TimerDel;
+    PendingRecycles.Add(Recycle);
+}
 
-    // Use lambda to capture the specific level instance
-    TimerDel.BindLambda([this, LevelToDestroy, NewTimerHandle]()
+void ASpawnLevel::ProcessPendingRecycles()
+{
+    if (PendingRecycles.IsEmpty())
+    {
+        return;
+    }
+
+    const double Now = GetWorld()->GetTimeSeconds();
+    int32 Released = 0;
+
+    while (!PendingRecycles.IsEmpty() && Released < MaxLevelRecyclesPerFrame
+        && PendingRecycles.First().ReleaseTime <= Now)
     {
-        if (LevelToDestroy.IsValid())
+        const TWeakObjectPtr<ABaseLevel> Level = PendingRecycles.PopFrontValue().Level;
+        if (Level.IsValid())
         {
-            ReturnLevelToPool(LevelToDestroy.Get());
-            UE_LOG(LogSideRunner, Verbose, TEXT("Destroyed old level segment"));
+            ReturnLevelToPool(Level.Get());
+            UE_LOG(LogSideRunner, Verbose, TEXT("Destroyed old level segment (%d still queued)"), PendingRecycles.Num());
         }
+        Released++;
+    }
+}
 
-        // Clean up timer handle from array
-        PendingDestroyTimers.Remove(NewTimerHandle);
-    });
-
-    GetWorld()->GetTimerManager().SetTimer(NewTimerHandle, TimerDel, LevelDestroyDelay, false);
-    PendingDestroyTimers.Add(NewTimerHandle);
+void ASpawnLevel::FlushPendingRecycles()
+{
+    while (!PendingRecycles.IsEmpty())
+    {
+        const TWeakObjectPtr<ABaseLevel> Level = PendingRecycles.PopFrontValue().Level;
+        if (Level.IsValid())
+        {
+            ReturnLevelToPool(Level.Get());
+        }
+    }
 }
 
 void ASpawnLevel::DestroyOldestLevel()
@@ -409,9 +672,7 @@ void ASpawnLevel::DestroyOldestLevel()
     // Legacy function kept for backward compatibility
     if (LevelList.Num() > 0)
     {
-        ABaseLevel* OldestLevel = LevelList[0];
-        LevelList.RemoveAt(0);
-        ReturnLevelToPool(OldestLevel);
+        ReturnLevelToPool(LevelList.PopFront().Level.Get());
     }
 }
 
@@ -426,29 +687,35 @@ void ASpawnLevel::ResetLevelsForRespawn()
 
     UE_LOG(LogSideRunner, Log, TEXT("ResetLevelsForRespawn: Clearing all levels for player respawn"));
 
-    // Clear all pending destroy timers to prevent callbacks on destroyed levels
-    for (FTimerHandle& TimerHandle : PendingDestroyTimers)
-    {
-        if (GetWorld())
-        {
-            GetWorld()->GetTimerManager().ClearTimer(TimerHandle);
-        }
-    }
-    PendingDestroyTimers.Empty();
+    // Release levels still waiting in the recycle queue so their actors go back to the pools
+    FlushPendingRecycles();
 
     // Destroy all existing levels and unbind delegates
-    for (ABaseLevel* Level : LevelList)
+    for (int32 i = 0; i < LevelList.Num(); ++i)
     {
-        ReturnLevelToPool(Level);
+        ReturnLevelToPool(LevelList[i].Level.Get());
     }
     LevelList.Empty();
 
+    PendingWarmSpawns = 0;
+
+#if UE_BUILD_DEVELOPMENT
+    if (ProceduralBuilder)
+    {
+        const FChunkLayoutCacheStats CacheStats = ProceduralBuilder->GetLayoutCacheStats();
+        UE_LOG(LogSideRunner, Log, TEXT("ResetLevelsForRespawn: Layout cache %d entries, %llu bytes (Hits=%d, Misses=%d, Evictions=%d)"),
+               CacheStats.NumEntries, static_cast<uint64>(CacheStats.AllocatedBytes),
+               CacheStats.Hits, CacheStats.Misses, CacheStats.Evictions);
+    }
+#endif
+
     // Re-acquire player reference and spawn fresh levels at player's current position
     TryAcquirePlayerPawn();
     if (PlayerWeakPtr.IsValid())
     {
+        // Replay the recorded chunks from the player's position so layouts are served from the cache
         FVector PlayerLoc = PlayerWeakPtr->GetActorLocation();
-        SpawnInitialLevels(FVector(0.0f, PlayerLoc.Y, 0.0f));
+        SpawnInitialLevels(BeginReplayAtY(PlayerLoc.Y));
         UE_LOG(LogSideRunner, Log, TEXT("ResetLevelsForRespawn: Spawned %d fresh levels at Y=%.1f"), LevelList.Num(), PlayerLoc.Y);
     }
     else
@@ -457,6 +724,87 @@ void ASpawnLevel::ResetLevelsForRespawn()
     }
 }
 
+void ASpawnLevel::WarmRespawn(const FVector& RespawnLocation)
+{
+    if (!bUseWarmRespawn)
+    {
+        ResetLevelsForRespawn();
+        return;
+    }
+
+    if (!GetWorld())
+    {
+        UE_LOG(LogSideRunner, Warning, TEXT("WarmRespawn: Called with no world, aborting."));
+        return;
+    }
+
+    // Retired levels go back to the pools first so replayed chunks can reuse their actors
+    FlushPendingRecycles();
+
+    // Keep the chunk covering the respawn point and everything after it; release the rest
+    const int32 KeepFrom = LevelList.FindIndexAtY(RespawnLocation.Y);
+    const int32 NumToRelease = KeepFrom != INDEX_NONE ? KeepFrom : LevelList.Num();
+    for (int32 i = 0; i < NumToRelease; ++i)
+    {
+        ReturnLevelToPool(LevelList.PopFront().Level.Get());
+    }
+    const int32 NumKept = LevelList.Num();
+
+    if (LevelList.IsEmpty())
+    {
+        // Only the ground under the player is needed this frame
+        FirstLevelSpawnPosition = BeginReplayAtY(RespawnLocation.Y);
+        SpawnLevel(true);
+    }
+
+    // Distance streaming tops itself up; trigger mode finishes the initial set from Tick
+    PendingWarmSpawns = bUseDistanceStreaming
+        ? 0
+        : FMath::Max(0, SpawnLevelConstants::INITIAL_LEVEL_COUNT - LevelList.Num());
+    LastEnteredLevel = nullptr;
+
+    UE_LOG(LogSideRunner, Log, TEXT("WarmRespawn: Kept %d levels, released %d, %d more queued (replaying chunk %d of %d)"),
+           NumKept, NumToRelease, PendingWarmSpawns, NextChunkOrdinal, RunHistory.Num());
+}
+
+void ASpawnLevel::ResetRun(const FVector& StartLocation)
+{
+    if (!GetWorld())
+    {
+        UE_LOG(LogSideRunner, Warning, TEXT("ResetRun: Called with no world, aborting."));
+        return;
+    }
+
+    // Every chunk goes back to the pools; the pools themselves outlive the run
+    FlushPendingRecycles();
+    while (!LevelList.IsEmpty())
+    {
+        ReturnLevelToPool(LevelList.PopFront().Level.Get());
+    }
+
+    // Coin totals count the new course only
+    if (UCoinPoolSubsystem* CoinPool = GetWorld()->GetSubsystem<UCoinPoolSubsystem>())
+    {
+        CoinPool->ResetChunkCoinRegistry();
+    }
+
+    // New course: fresh seed, nothing to replay
+    RunHistory.Reset();
+    NextChunkOrdinal = 0;
+    NextProceduralChunkIndex = 0;
+    CurrentSeed = FMath::Rand();
+    LastEnteredLevel = nullptr;
+
+    // Ground under the player now, the rest of the initial set over the next frames
+    FirstLevelSpawnPosition = FVector(0.0f, StartLocation.Y, 0.0f);
+    SpawnLevel(true);
+    PendingWarmSpawns = bUseDistanceStreaming
+        ? 0
+        : FMath::Max(0, SpawnLevelConstants::INITIAL_LEVEL_COUNT - LevelList.Num());
+
+    UE_LOG(LogSideRunner, Log, TEXT("ResetRun: New run at Y=%.1f (Seed=%d)"), StartLocation.Y, CurrentSeed);
+}
+
 void ASpawnLevel::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
     UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep,
     const FHitResult& SweepResult)
@@ -2,6 +2,8 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "Containers/RingBuffer.h"
+#include "LevelChunkRing.h"
 #include "SpawnLevel.generated.h"
 
 class ABaseLevel;
@@ -37,6 +39,36 @@ public:
     UFUNCTION(BlueprintCallable, Category="Level Management")
     void ResetLevelsForRespawn();
 
+    /**
+     * Fast respawn: keeps live chunks that already cover the respawn position and replays
+     * the rest of the run's recorded chunks from there (same seeds, so layouts come from the
+     * cache). Only the chunk under the player is spawned this frame; the rest follow one per frame.
+     *
+     * @param RespawnLocation - World location the player is being teleported to
+     */
+    UFUNCTION(BlueprintCallable, Category="Level Management")
+    void WarmRespawn(const FVector& RespawnLocation);
+
+    /**
+     * Starts a new run in place: returns every chunk's actors to the pools, discards the
+     * recorded course, picks a new seed and rebuilds the initial chunks at StartLocation.
+     * Pools, cached layouts and loaded assets survive (no map reload).
+     *
+     * @param StartLocation - World location the new run starts from
+     */
+    UFUNCTION(BlueprintCallable, Category="Level Management")
+    void ResetRun(const FVector& StartLocation);
+
+    /**
+     * Returns the live chunk record containing the player's Y position, or nullptr.
+     * PERFORMANCE: Amortized O(1) via the chunk ring's cursor.
+     */
+    const FLevelChunkRecord* GetChunkUnderPlayer() const;
+
+    /** Number of levels waiting in the deferred recycle queue. */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category="Level Management")
+    int32 GetPendingRecycleCount() const { return PendingRecycles.Num(); }
+
 protected:
     /** Weak reference to player pawn - handles pawn respawn/death correctly */
     TWeakObjectPtr<APawn> PlayerWeakPtr;
@@ -62,6 +94,10 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Level Management")
     float LevelDestroyDelay = 1.0f; // Delay before destroying the oldest level
 
+    /** Maximum number of expired levels recycled per frame (spreads pool returns across frames). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Level Management", meta=(ClampMin="1", ClampMax="8"))
+    int32 MaxLevelRecyclesPerFrame = 1;
+
     // ======================================================================
     // Procedural Generation
     // ======================================================================
@@ -78,10 +114,35 @@ protected:
     UPROPERTY()
     UDifficultyScaler* DifficultyScaler;
 
+    /** When true, respawning keeps nearby chunks and replays the rest (WarmRespawn) instead of a full reset. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Level Management")
+    bool bUseWarmRespawn = true;
+
     /** Maximum number of active levels before oldest is destroyed. Replaces hardcoded 6. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Level Management", meta=(ClampMin="3", ClampMax="12"))
     int32 MaxActiveLevels = 6;
 
+    // ======================================================================
+    // Distance Streaming
+    // ======================================================================
+
+    /** When true, chunks are spawned/recycled by comparing the player's Y to each chunk's
+     *  recorded start/end instead of via trigger box overlaps. Triggers are disabled. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Level Streaming")
+    bool bUseDistanceStreaming = false;
+
+    /** Spawned content must extend at least this far (Unreal units) ahead of the player. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Level Streaming", meta=(ClampMin="500.0", ClampMax="20000.0", EditCondition="bUseDistanceStreaming"))
+    float StreamAheadDistance = 6000.0f;
+
+    /** Chunks ending further than this (Unreal units) behind the player are recycled. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Level Streaming", meta=(ClampMin="0.0", ClampMax="20000.0", EditCondition="bUseDistanceStreaming"))
+    float StreamBehindDistance = 2000.0f;
+
+    /** Maximum chunks spawned per frame while catching up (bounds hitches at high speed). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Level Streaming", meta=(ClampMin="1", ClampMax="4", EditCondition="bUseDistanceStreaming"))
+    int32 MaxStreamSpawnsPerFrame = 1;
+
     /** Distance (meters) at which procedural generation begins in hybrid mode.
      *  Before this distance, handcrafted BP_Level1-6 are used. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Procedural Generation", meta=(ClampMin="0.0", ClampMax="10000.0"))
@@ -91,18 +152,39 @@ private:
     FVector SpawnLocation;
     FRotator SpawnRotation;
 
-    UPROPERTY()
-    TArray<ABaseLevel*> LevelList;
+    /** Live chunks, oldest first. Capacity is MaxActiveLevels + 1 (a new chunk is pushed before the oldest retires). */
+    FLevelChunkRing LevelList;
+
+    /** Appends a spawned chunk and retires the oldest once over MaxActiveLevels. */
+    void AddChunkRecord(const FLevelChunkRecord& Record);
+
+    /** Binds the overlap trigger, or disables it entirely in distance streaming mode. */
+    void ConfigureLevelTrigger(ABaseLevel* Level);
+
+    /** Counts the coin pickups a handcrafted level carries (attached child actors and LevelActors). */
+    static int32 CountLevelCoins(ABaseLevel* Level);
+
+    /** Distance streaming: spawn ahead, recycle behind and fire chunk-entered events. */
+    void UpdateDistanceStreaming();
+
+    /** Level the player was last inside (distance streaming broadcasts OnLevelTriggered on change). */
+    TWeakObjectPtr<ABaseLevel> LastEnteredLevel;
 
     void SpawnInitialLevels(const FVector& StartPosition = FVector(0.0f, 1000.0f, 0.0f));
     void DelayedDestroyOldestLevel();
     void TryAcquirePlayerPawn();
 
-    /** Procedural spawn path: spawn a bare ABaseLevel and fill with generated content. */
-    void SpawnProceduralLevel(const FVector& SpawnPos, const FRotator& SpawnRot);
+    /**
+     * Procedural spawn path: spawn a bare ABaseLevel and fill with generated content.
+     * @param Replay - Recorded chunk to regenerate (same seed/index/difficulty), or nullptr for a new chunk
+     */
+    void SpawnProceduralLevel(const FVector& SpawnPos, const FRotator& SpawnRot, const FLevelChunkRecord* Replay = nullptr);
 
-    /** Handcrafted spawn path: pick a random BP_Level1-6. */
-    void SpawnHandcraftedLevel(const FVector& SpawnPos, const FRotator& SpawnRot);
+    /**
+     * Handcrafted spawn path: pick a random BP_Level1-6.
+     * @param Replay - Recorded chunk to respawn (same class and coin registry key), or nullptr to pick at random
+     */
+    void SpawnHandcraftedLevel(const FVector& SpawnPos, const FRotator& SpawnRot, const FLevelChunkRecord* Replay = nullptr);
 
     /** Returns current player distance in meters for difficulty calculation. */
     float GetCurrentDistanceMeters() const;
@@ -116,12 +198,56 @@ private:
     /** Cached first-level spawn position - updated on each spawn cycle to match player location */
     FVector FirstLevelSpawnPosition = FVector(0.0f, 1000.0f, 0.0f);
 
-    /** Array of timer handles for pending destroy operations */
-    TArray<FTimerHandle> PendingDestroyTimers;
+    /** A level retired from LevelList, waiting for its destroy delay to elapse. */
+    struct FPendingRecycle
+    {
+        TWeakObjectPtr<ABaseLevel> Level;
+        double ReleaseTime = 0.0;
+    };
 
-    /** Current seed for procedural generation (incremented per chunk). */
+    /**
+     * FIFO of retired levels. Every entry uses the same delay, so release times are
+     * monotonic and only the front ever needs checking.
+     */
+    TRingBuffer<FPendingRecycle> PendingRecycles;
+
+    /** Releases expired levels from the front of the queue, at most MaxLevelRecyclesPerFrame. */
+    void ProcessPendingRecycles();
+
+    /** Releases every queued level immediately (respawn/teardown). */
+    void FlushPendingRecycles();
+
+    /** Seed for procedural generation, fixed for the session. Combined with the chunk index per chunk. */
     int32 CurrentSeed = 0;
 
+    /**
+     * Index of the next procedural chunk within the run (counter input for FChunkRandom).
+     * Handcrafted chunks draw from it too, as their coin registry key, so keys never collide.
+     */
+    int32 NextProceduralChunkIndex = 0;
+
+    // ======================================================================
+    // Respawn Replay
+    // ======================================================================
+
+    /** Every chunk spawned this run, in course order (Level pointers may be stale). */
+    TArray<FLevelChunkRecord> RunHistory;
+
+    /** Position in RunHistory of the next chunk to spawn; == RunHistory.Num() when generating new chunks. */
+    int32 NextChunkOrdinal = 0;
+
+    /** Chunks still to be spawned after a warm respawn, one per frame. */
+    int32 PendingWarmSpawns = 0;
+
+    /** Stores a new chunk in the run history, or advances past the replayed one. */
+    void RecordChunkSpawn(const FLevelChunkRecord& Record, bool bReplayed);
+
+    /**
+     * Positions replay at the recorded chunk containing Y and returns where that chunk starts.
+     * If Y is outside the recorded course the history is discarded and Y itself is returned.
+     */
+    FVector BeginReplayAtY(float Y);
+
     /** Cached game instance for distance queries. */
     UPROPERTY()
     USideRunnerGameInstance* CachedGameInstance;
@@ -0,0 +1,168 @@
+#include "StatusEffectComponent.h"
+#include "Engine/World.h"
+#include "SideRunner.h" // Custom log categories
+
+UStatusEffectComponent::UStatusEffectComponent()
+{
+    PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UStatusEffectComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    ClearEffects();
+
+    Super::EndPlay(EndPlayReason);
+}
+
+// ======================================================================
+// Effects
+// ======================================================================
+
+void UStatusEffectComponent::ApplyEffect(FName Effect, float Duration)
+{
+    if (Effect.IsNone() || Duration <= 0.0f || !GetWorld())
+    {
+        return;
+    }
+
+    const double Now = GetWorldTimeSeconds();
+
+    FActiveEffect* Active = FindEffect(Effect);
+    if (Active)
+    {
+        const double PreviousExpiry = Active->Status.ExpiresAt;
+        Active->Status.Extend(Now, Duration);
+        if (Active->Status.ExpiresAt != PreviousExpiry)
+        {
+            ScheduleExpiry(*Active);
+        }
+    }
+    else
+    {
+        Active = &ActiveEffects.AddDefaulted_GetRef();
+        Active->Effect = Effect;
+        Active->Status.Start(Now, Duration);
+        ScheduleExpiry(*Active);
+    }
+
+    OnEffectApplied.Broadcast(Effect, Duration);
+
+#if UE_BUILD_DEVELOPMENT
+    UE_LOG(LogSideRunner, Verbose, TEXT("[StatusEffects] %s: %s for %.2fs"), *GetOwner()->GetName(), *Effect.ToString(), Duration);
+#endif
+}
+
+void UStatusEffectComponent::RemoveEffect(FName Effect, bool bFireExpired)
+{
+    const int32 Index = ActiveEffects.IndexOfByPredicate([Effect](const FActiveEffect& Active) { return Active.Effect == Effect; });
+    if (Index == INDEX_NONE)
+    {
+        return;
+    }
+
+    const bool bWasActive = ActiveEffects[Index].Status.IsActive(GetWorldTimeSeconds());
+    CancelExpiry(ActiveEffects[Index]);
+    ActiveEffects.RemoveAtSwap(Index);
+
+    if (bWasActive && bFireExpired)
+    {
+        OnEffectExpired.Broadcast(Effect);
+    }
+}
+
+void UStatusEffectComponent::ClearEffects()
+{
+    for (FActiveEffect& Active : ActiveEffects)
+    {
+        CancelExpiry(Active);
+    }
+    ActiveEffects.Empty();
+}
+
+bool UStatusEffectComponent::HasEffect(FName Effect) const
+{
+    const FActiveEffect* Active = FindEffect(Effect);
+    return Active && Active->Status.IsActive(GetWorldTimeSeconds());
+}
+
+float UStatusEffectComponent::GetRemainingTime(FName Effect) const
+{
+    const FActiveEffect* Active = FindEffect(Effect);
+    return Active ? Active->Status.GetRemaining(GetWorldTimeSeconds()) : 0.0f;
+}
+
+UStatusEffectComponent::FActiveEffect* UStatusEffectComponent::FindEffect(FName Effect)
+{
+    return ActiveEffects.FindByPredicate([Effect](const FActiveEffect& Active) { return Active.Effect == Effect; });
+}
+
+const UStatusEffectComponent::FActiveEffect* UStatusEffectComponent::FindEffect(FName Effect) const
+{
+    return ActiveEffects.FindByPredicate([Effect](const FActiveEffect& Active) { return Active.Effect == Effect; });
+}
+
+double UStatusEffectComponent::GetWorldTimeSeconds() const
+{
+    const UWorld* World = GetWorld();
+    return World ? World->GetTimeSeconds() : 0.0;
+}
+
+// ======================================================================
+// Expiry
+// ======================================================================
+
+UStatusEffectSubsystem* UStatusEffectComponent::GetExpirySubsystem() const
+{
+    const UWorld* World = GetWorld();
+    return World ? World->GetSubsystem<UStatusEffectSubsystem>() : nullptr;
+}
+
+void UStatusEffectComponent::ScheduleExpiry(FActiveEffect& Active)
+{
+    UStatusEffectSubsystem* Subsystem = GetExpirySubsystem();
+    if (!Subsystem)
+    {
+        // Editor/preview worlds: effects still time out via their timestamp, just without events
+        return;
+    }
+
+    Subsystem->CancelExpiry(Active.ExpiryHandle);
+    Active.ExpiryHandle = Subsystem->ScheduleExpiry(this, Active.Effect, Active.Status.ExpiresAt);
+}
+
+void UStatusEffectComponent::CancelExpiry(FActiveEffect& Active)
+{
+    if (Active.ExpiryHandle.IsValid())
+    {
+        if (UStatusEffectSubsystem* Subsystem = GetExpirySubsystem())
+        {
+            Subsystem->CancelExpiry(Active.ExpiryHandle);
+        }
+        Active.ExpiryHandle = UStatusEffectSubsystem::FExpiryHandle();
+    }
+}
+
+void UStatusEffectComponent::HandleEffectExpired(FName Effect)
+{
+    const int32 Index = ActiveEffects.IndexOfByPredicate([Effect](const FActiveEffect& Active) { return Active.Effect == Effect; });
+    if (Index == INDEX_NONE)
+    {
+        return;
+    }
+
+    // The wheel handle has already fired
+    FActiveEffect& Active = ActiveEffects[Index];
+    Active.ExpiryHandle = UStatusEffectSubsystem::FExpiryHandle();
+
+    if (Active.Status.IsActive(GetWorldTimeSeconds()))
+    {
+        // Floating-point edge of the tick quantization; try again next wheel tick
+        ScheduleExpiry(Active);
+        return;
+    }
+
+    ActiveEffects.RemoveAtSwap(Index);
+
+    // Broadcast last: listeners may apply new effects
+    OnEffectExpired.Broadcast(Effect);
+}
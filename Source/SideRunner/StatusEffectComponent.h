@@ -0,0 +1,101 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "TimedStatus.h"
+#include "StatusEffectSubsystem.h"
+#include "StatusEffectComponent.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnStatusEffectApplied, FName, Effect, float, Duration);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnStatusEffectExpired, FName, Effect);
+
+/** Names of the built-in status effects. Any other name works as a custom effect. */
+namespace StatusEffectNames
+{
+    inline const FName Invincibility(TEXT("Invincibility"));
+    inline const FName Magnet(TEXT("Magnet"));
+    inline const FName SpeedBoost(TEXT("SpeedBoost"));
+    inline const FName Slow(TEXT("Slow"));
+}
+
+/**
+ * Timed status effects (invincibility, magnet, speed boost, slow, ...) for any actor, keyed by name.
+ * Each effect is an expiry timestamp: queries compute activity and remaining time on demand.
+ *
+ * PERFORMANCE: Never ticks and owns no timers. Expiries are scheduled on the world's shared
+ * UStatusEffectSubsystem timing wheel, so every effect on every actor costs O(1) to apply or cancel.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class SIDERUNNER_API UStatusEffectComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UStatusEffectComponent();
+
+    /**
+     * Applies an effect, or extends it if already active (it ends at the later of the two expiries).
+     *
+     * @param Effect - Effect name
+     * @param Duration - Seconds from now
+     */
+    UFUNCTION(BlueprintCallable, Category = "Status Effects")
+    void ApplyEffect(FName Effect, float Duration);
+
+    /**
+     * Ends an effect now.
+     *
+     * @param Effect - Effect name
+     * @param bFireExpired - Fire OnEffectExpired if the effect was active
+     */
+    UFUNCTION(BlueprintCallable, Category = "Status Effects")
+    void RemoveEffect(FName Effect, bool bFireExpired = true);
+
+    /** Ends every effect without firing events. */
+    UFUNCTION(BlueprintCallable, Category = "Status Effects")
+    void ClearEffects();
+
+    /** True while the effect is active. */
+    UFUNCTION(BlueprintPure, Category = "Status Effects")
+    bool HasEffect(FName Effect) const;
+
+    /** Seconds left on the effect (0 if inactive). */
+    UFUNCTION(BlueprintPure, Category = "Status Effects")
+    float GetRemainingTime(FName Effect) const;
+
+    /** Called by UStatusEffectSubsystem when an effect's scheduled expiry is reached. */
+    void HandleEffectExpired(FName Effect);
+
+    UPROPERTY(BlueprintAssignable, Category = "Status Effects|Events")
+    FOnStatusEffectApplied OnEffectApplied;
+
+    UPROPERTY(BlueprintAssignable, Category = "Status Effects|Events")
+    FOnStatusEffectExpired OnEffectExpired;
+
+protected:
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+    struct FActiveEffect
+    {
+        FName Effect;
+        FTimedStatus Status;
+        UStatusEffectSubsystem::FExpiryHandle ExpiryHandle;
+    };
+
+    /** (Re)schedules an effect's expiry on the shared wheel, cancelling any previous one. */
+    void ScheduleExpiry(FActiveEffect& Active);
+
+    /** Cancels an effect's pending expiry. */
+    void CancelExpiry(FActiveEffect& Active);
+
+    UStatusEffectSubsystem* GetExpirySubsystem() const;
+
+    double GetWorldTimeSeconds() const;
+
+    FActiveEffect* FindEffect(FName Effect);
+    const FActiveEffect* FindEffect(FName Effect) const;
+
+    // Few effects per actor, so a flat array beats a map
+    TArray<FActiveEffect> ActiveEffects;
+};
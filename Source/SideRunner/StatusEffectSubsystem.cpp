@@ -0,0 +1,63 @@
+#include "StatusEffectSubsystem.h"
+#include "StatusEffectComponent.h"
+#include "Engine/World.h"
+
+void UStatusEffectSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+    Wheel.Reset(TimeToTick(InWorld.GetTimeSeconds(), false));
+}
+
+void UStatusEffectSubsystem::Deinitialize()
+{
+    Wheel.Reset(0);
+    Super::Deinitialize();
+}
+
+bool UStatusEffectSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UStatusEffectSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UStatusEffectSubsystem, STATGROUP_Tickables);
+}
+
+uint64 UStatusEffectSubsystem::TimeToTick(double TimeSeconds, bool bRoundUp)
+{
+    const double Ticks = FMath::Max(0.0, TimeSeconds) / TickResolutionSeconds;
+    return static_cast<uint64>(bRoundUp ? FMath::CeilToDouble(Ticks) : FMath::FloorToDouble(Ticks));
+}
+
+void UStatusEffectSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    const UWorld* World = GetWorld();
+    if (!World || Wheel.Num() == 0)
+    {
+        return;
+    }
+
+    Wheel.Advance(TimeToTick(World->GetTimeSeconds(), false), [](const FExpiry& Expiry)
+    {
+        if (UStatusEffectComponent* Component = Expiry.Component.Get())
+        {
+            Component->HandleEffectExpired(Expiry.Effect);
+        }
+    });
+}
+
+UStatusEffectSubsystem::FExpiryHandle UStatusEffectSubsystem::ScheduleExpiry(UStatusEffectComponent* Component, FName Effect, double ExpiresAt)
+{
+    FExpiry Expiry;
+    Expiry.Component = Component;
+    Expiry.Effect = Effect;
+    return Wheel.Schedule(TimeToTick(ExpiresAt, true), Expiry);
+}
+
+void UStatusEffectSubsystem::CancelExpiry(FExpiryHandle Handle)
+{
+    Wheel.Cancel(Handle);
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TimingWheel.h"
+#include "StatusEffectSubsystem.generated.h"
+
+class UStatusEffectComponent;
+
+/**
+ * Schedules the expiry of every status effect in the world on one hierarchical timing wheel,
+ * advanced once per frame. UStatusEffectComponent uses this instead of owning timers.
+ *
+ * PERFORMANCE: Per-frame cost is one wheel advance (a slot or two per elapsed wheel tick) plus the
+ * effects that actually expire — independent of how many effects or actors are active.
+ */
+UCLASS()
+class SIDERUNNER_API UStatusEffectSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Expiry granularity; effects end on the first frame at or after their expiry time. */
+    static constexpr double TickResolutionSeconds = 1.0 / 60.0;
+
+    struct FExpiry
+    {
+        TWeakObjectPtr<UStatusEffectComponent> Component;
+        FName Effect;
+    };
+
+    using FExpiryWheel = TTimingWheel<FExpiry>;
+    using FExpiryHandle = FExpiryWheel::FHandle;
+
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /**
+     * Schedules a component's effect to expire at a world time.
+     *
+     * @param Component - Component notified through HandleEffectExpired
+     * @param Effect - Effect name passed back on expiry
+     * @param ExpiresAt - World time (seconds)
+     * @return Handle for CancelExpiry
+     */
+    FExpiryHandle ScheduleExpiry(UStatusEffectComponent* Component, FName Effect, double ExpiresAt);
+
+    /** Cancels a scheduled expiry. Stale handles are ignored. */
+    void CancelExpiry(FExpiryHandle Handle);
+
+    /** Number of scheduled expiries in the world. */
+    int32 GetNumScheduled() const { return Wheel.Num(); }
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    /** World time to wheel tick; rounds up so an effect never expires early. */
+    static uint64 TimeToTick(double TimeSeconds, bool bRoundUp);
+
+    FExpiryWheel Wheel;
+};
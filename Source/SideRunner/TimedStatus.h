@@ -0,0 +1,47 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * A timed state stored as the world time at which it ends.
+ * Activity and remaining time are computed on demand from the current time, so nothing
+ * has to count down while the state is active.
+ *
+ * PERFORMANCE: No polling timer or tick per status — when an expiry event is needed,
+ * schedule it on UStatusEffectSubsystem's shared timing wheel.
+ */
+struct FTimedStatus
+{
+    /** World time (seconds) at which the status ends; 0 = inactive */
+    double ExpiresAt = 0.0;
+
+    /** Starts (or restarts) the status for Duration seconds from Now. */
+    FORCEINLINE void Start(double Now, float Duration)
+    {
+        ExpiresAt = Now + FMath::Max(0.0f, Duration);
+    }
+
+    /** Extends the status to end no earlier than Duration seconds from Now. */
+    FORCEINLINE void Extend(double Now, float Duration)
+    {
+        ExpiresAt = FMath::Max(ExpiresAt, Now + FMath::Max(0.0f, Duration));
+    }
+
+    /** Ends the status immediately. */
+    FORCEINLINE void Clear()
+    {
+        ExpiresAt = 0.0;
+    }
+
+    /** True while Now is before the expiry time. */
+    FORCEINLINE bool IsActive(double Now) const
+    {
+        return Now < ExpiresAt;
+    }
+
+    /** Seconds left at Now (0 when inactive). */
+    FORCEINLINE float GetRemaining(double Now) const
+    {
+        return static_cast<float>(FMath::Max(0.0, ExpiresAt - Now));
+    }
+};
@@ -0,0 +1,301 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Hierarchical timing wheel: schedules payloads to fire at integer ticks.
+ * Level 0 has one slot per tick; each higher level has one slot per full turn of the level below,
+ * and its entries cascade down as time reaches them.
+ *
+ * PERFORMANCE: Schedule and Cancel are O(1). Advancing one tick touches one level-0 slot plus,
+ * once every NumSlots ticks, one slot per higher level — the cost does not depend on how many
+ * entries are scheduled, only on how many fire. Entries live in one pooled array (no per-entry
+ * allocation) and are linked intrusively, so cancelling never searches.
+ *
+ * Not thread-safe; owned and advanced on the game thread.
+ */
+template <typename PayloadType>
+class TTimingWheel
+{
+public:
+    static constexpr int32 SlotBits = 6;
+    static constexpr int32 NumSlots = 1 << SlotBits;
+    static constexpr int32 NumLevels = 4;
+    static constexpr uint64 SlotMask = NumSlots - 1;
+
+    /** Furthest a deadline can lie ahead before it is parked at the top level and re-cascaded */
+    static constexpr uint64 MaxDelta = (uint64(1) << (SlotBits * NumLevels)) - 1;
+
+    /** Identifies a scheduled entry; stale handles are rejected by Cancel. */
+    struct FHandle
+    {
+        int32 Index = INDEX_NONE;
+        uint32 Serial = 0;
+
+        bool IsValid() const { return Index != INDEX_NONE; }
+    };
+
+    TTimingWheel()
+    {
+        Reset(0);
+    }
+
+    /** Drops every entry and restarts the wheel at InCurrentTick. */
+    void Reset(uint64 InCurrentTick)
+    {
+        Entries.Reset();
+        FreeEntries.Reset();
+        for (int32& Head : Heads)
+        {
+            Head = INDEX_NONE;
+        }
+        CurrentTick = InCurrentTick;
+        NumScheduled = 0;
+    }
+
+    /**
+     * Schedules a payload. Deadlines at or before the current tick fire on the next Advance.
+     *
+     * @param DeadlineTick - Tick at which the payload fires
+     * @param Payload - Value handed to the expiry callback
+     * @return Handle for Cancel
+     */
+    FHandle Schedule(uint64 DeadlineTick, const PayloadType& Payload)
+    {
+        int32 EntryIndex;
+        if (FreeEntries.Num() > 0)
+        {
+            EntryIndex = FreeEntries.Pop();
+        }
+        else
+        {
+            EntryIndex = Entries.AddDefaulted();
+        }
+
+        FEntry& Entry = Entries[EntryIndex];
+        Entry.Payload = Payload;
+        Entry.Deadline = FMath::Max(DeadlineTick, CurrentTick + 1);
+        Entry.Serial = ++NextSerial;
+        Insert(EntryIndex);
+        NumScheduled++;
+
+        FHandle Handle;
+        Handle.Index = EntryIndex;
+        Handle.Serial = Entry.Serial;
+        return Handle;
+    }
+
+    /**
+     * Unschedules an entry. Safe to call with a stale or already-fired handle.
+     *
+     * @return True if the entry was still scheduled
+     */
+    bool Cancel(FHandle Handle)
+    {
+        if (!Entries.IsValidIndex(Handle.Index))
+        {
+            return false;
+        }
+
+        FEntry& Entry = Entries[Handle.Index];
+        if (Entry.Serial != Handle.Serial || Entry.Bucket == INDEX_NONE)
+        {
+            return false;
+        }
+
+        // Entries already taken off the wheel for firing are only released (Advance skips them)
+        if (Entry.Bucket != FiringBucket)
+        {
+            Unlink(Handle.Index);
+        }
+        Release(Handle.Index);
+        return true;
+    }
+
+    /**
+     * Advances to NewTick, firing every entry whose deadline has been reached.
+     * Callbacks may schedule or cancel entries.
+     *
+     * @param NewTick - Tick to advance to (ignored if not ahead of the current tick)
+     * @param OnExpired - Called as OnExpired(const PayloadType&) for each entry that fires
+     */
+    template <typename FuncType>
+    void Advance(uint64 NewTick, FuncType&& OnExpired)
+    {
+        if (NumScheduled == 0)
+        {
+            // Nothing can fire; skip the empty ticks
+            CurrentTick = FMath::Max(CurrentTick, NewTick);
+            return;
+        }
+
+        while (CurrentTick < NewTick)
+        {
+            CurrentTick++;
+
+            // Cascade from the highest level whose slot turns over at this tick
+            int32 TopLevel = 0;
+            while (TopLevel + 1 < NumLevels && ((CurrentTick >> (SlotBits * TopLevel)) & SlotMask) == 0)
+            {
+                TopLevel++;
+            }
+            for (int32 Level = TopLevel; Level >= 1; --Level)
+            {
+                Reinsert(GetBucket(Level, (CurrentTick >> (SlotBits * Level)) & SlotMask));
+            }
+
+            // Take this tick's slot off the wheel first, so callbacks can schedule and cancel freely
+            FiringList.Reset();
+            int32 EntryIndex = DetachBucket(GetBucket(0, CurrentTick & SlotMask));
+            while (EntryIndex != INDEX_NONE)
+            {
+                FEntry& Entry = Entries[EntryIndex];
+                const int32 NextIndex = Entry.Next;
+                Entry.Bucket = FiringBucket;
+                Entry.Prev = INDEX_NONE;
+                Entry.Next = INDEX_NONE;
+                FiringList.Add({ EntryIndex, Entry.Serial });
+                EntryIndex = NextIndex;
+            }
+
+            for (int32 i = 0; i < FiringList.Num(); ++i)
+            {
+                const FHandle Firing = FiringList[i];
+                if (Entries[Firing.Index].Serial != Firing.Serial || Entries[Firing.Index].Bucket != FiringBucket)
+                {
+                    continue; // Cancelled by an earlier callback
+                }
+
+                if (Entries[Firing.Index].Deadline <= CurrentTick)
+                {
+                    const PayloadType Payload = Entries[Firing.Index].Payload;
+                    Release(Firing.Index);
+                    OnExpired(Payload);
+                }
+                else
+                {
+                    // Parked beyond MaxDelta; goes round again
+                    Insert(Firing.Index);
+                }
+            }
+
+            if (NumScheduled == 0)
+            {
+                CurrentTick = NewTick;
+            }
+        }
+    }
+
+    /** Number of scheduled entries. */
+    int32 Num() const { return NumScheduled; }
+
+    /** The last tick advanced to. */
+    uint64 GetCurrentTick() const { return CurrentTick; }
+
+private:
+    struct FEntry
+    {
+        PayloadType Payload;
+        uint64 Deadline = 0;
+        uint32 Serial = 0;
+        int32 Prev = INDEX_NONE;
+        int32 Next = INDEX_NONE;
+
+        /** Level * NumSlots + Slot, or INDEX_NONE when free */
+        int32 Bucket = INDEX_NONE;
+    };
+
+    /** Bucket marker for entries detached for firing in the current tick */
+    static constexpr int32 FiringBucket = -2;
+
+    static int32 GetBucket(int32 Level, uint64 Slot)
+    {
+        return Level * NumSlots + static_cast<int32>(Slot);
+    }
+
+    void Insert(int32 EntryIndex)
+    {
+        FEntry& Entry = Entries[EntryIndex];
+        const uint64 Delta = Entry.Deadline - CurrentTick;
+        const uint64 SlotTick = Delta > MaxDelta ? CurrentTick + MaxDelta : Entry.Deadline;
+        const uint64 SlotDelta = SlotTick - CurrentTick;
+
+        // Lowest level whose span covers the delta
+        int32 Level = 0;
+        while (Level + 1 < NumLevels && SlotDelta >= (uint64(1) << (SlotBits * (Level + 1))))
+        {
+            Level++;
+        }
+
+        const int32 Bucket = GetBucket(Level, (SlotTick >> (SlotBits * Level)) & SlotMask);
+        Entry.Bucket = Bucket;
+        Entry.Prev = INDEX_NONE;
+        Entry.Next = Heads[Bucket];
+        if (Entry.Next != INDEX_NONE)
+        {
+            Entries[Entry.Next].Prev = EntryIndex;
+        }
+        Heads[Bucket] = EntryIndex;
+    }
+
+    void Unlink(int32 EntryIndex)
+    {
+        FEntry& Entry = Entries[EntryIndex];
+        if (Entry.Prev != INDEX_NONE)
+        {
+            Entries[Entry.Prev].Next = Entry.Next;
+        }
+        else
+        {
+            Heads[Entry.Bucket] = Entry.Next;
+        }
+        if (Entry.Next != INDEX_NONE)
+        {
+            Entries[Entry.Next].Prev = Entry.Prev;
+        }
+        Entry.Prev = INDEX_NONE;
+        Entry.Next = INDEX_NONE;
+    }
+
+    /** Empties a bucket and returns its former list head (entries keep their Next links). */
+    int32 DetachBucket(int32 Bucket)
+    {
+        const int32 Head = Heads[Bucket];
+        Heads[Bucket] = INDEX_NONE;
+        return Head;
+    }
+
+    /** Re-files every entry of a higher-level bucket against the current tick. */
+    void Reinsert(int32 Bucket)
+    {
+        int32 EntryIndex = DetachBucket(Bucket);
+        while (EntryIndex != INDEX_NONE)
+        {
+            const int32 NextIndex = Entries[EntryIndex].Next;
+            Insert(EntryIndex);
+            EntryIndex = NextIndex;
+        }
+    }
+
+    void Release(int32 EntryIndex)
+    {
+        FEntry& Entry = Entries[EntryIndex];
+        Entry.Bucket = INDEX_NONE;
+        Entry.Prev = INDEX_NONE;
+        Entry.Next = INDEX_NONE;
+        Entry.Payload = PayloadType();
+        FreeEntries.Add(EntryIndex);
+        NumScheduled--;
+    }
+
+    TArray<FEntry> Entries;
+    TArray<int32> FreeEntries;
+    int32 Heads[NumLevels * NumSlots];
+
+    /** Scratch list of the entries firing this tick (kept to avoid reallocating) */
+    TArray<FHandle> FiringList;
+
+    uint64 CurrentTick = 0;
+    uint32 NextSerial = 0;
+    int32 NumScheduled = 0;
+};
@@ -65,6 +65,7 @@ AWallSpike::AWallSpike()
 	bTrackingPlayerDeath = false;
 	TimeBehindPlayer = 0.0f;
 	ChaseAudioComponent = nullptr;
+	bManagedByPool = false;
 }
 
 void AWallSpike::BeginPlay()
@@ -304,12 +305,16 @@ void AWallSpike::HandleChaseAudioStart(bool bWasHasTarget)
 											 ChaseVolumeMultiplier, ChasePitchMultiplier);
 	}
 	
-	if (!bWasHasTarget && ChaseLoopSound && !ChaseAudioComponent)
+	if (!bWasHasTarget && ChaseLoopSound)
 	{
-		ChaseAudioComponent = UGameplayStatics::SpawnSoundAttached(
-			ChaseLoopSound, GetRootComponent(), NAME_None, FVector::ZeroVector,
-			EAttachLocation::KeepRelativeOffset, false, 
-			ChaseVolumeMultiplier, ChasePitchMultiplier, 0.0f, nullptr, nullptr, true);
+		// PERFORMANCE: One loop component per spike, kept (not auto-destroyed) across chases and pool reuse
+		if (!ChaseAudioComponent)
+		{
+			ChaseAudioComponent = UGameplayStatics::SpawnSoundAttached(
+				ChaseLoopSound, GetRootComponent(), NAME_None, FVector::ZeroVector,
+				EAttachLocation::KeepRelativeOffset, false, 
+				ChaseVolumeMultiplier, ChasePitchMultiplier, 0.0f, nullptr, nullptr, false);
+		}
 		
 		if (ChaseAudioComponent && !ChaseAudioComponent->IsPlaying())
 		{
@@ -462,7 +467,7 @@ void AWallSpike::CheckLifetimeAndCleanup()
 #if UE_BUILD_DEBUG
 			UE_LOG(LogSideRunnerCombat, Log, TEXT("WallSpike destroying self - player dead for %.1fs"), PlayerDeathTimer);
 #endif
-			Destroy();
+			RetireSpike();
 			return;
 		}
 		return;
@@ -486,7 +491,7 @@ void AWallSpike::CheckLifetimeAndCleanup()
 #if UE_BUILD_DEBUG
 			UE_LOG(LogSideRunnerCombat, Log, TEXT("WallSpike destroying self - too far behind"));
 #endif
-			Destroy();
+			RetireSpike();
 			return;
 		}
 		
@@ -496,7 +501,7 @@ void AWallSpike::CheckLifetimeAndCleanup()
 #if UE_BUILD_DEBUG
 			UE_LOG(LogSideRunnerCombat, Log, TEXT("WallSpike destroying self - behind too long"));
 #endif
-			Destroy();
+			RetireSpike();
 			return;
 		}
 	}
@@ -561,18 +566,68 @@ void AWallSpike::ApplyInstantDeathToPlayer(ARunnerCharacter* Player, FVector Hit
 	if (!World)
 	{
 		// If no world, destroy immediately instead of using timer
-		Destroy();
+		RetireSpike();
 		return;
 	}
 
 	// Store timer handle so we can cancel it if player respawns
-	World->GetTimerManager().SetTimer(DeathDestroyTimerHandle, [this]()
+	World->GetTimerManager().SetTimer(DeathDestroyTimerHandle, this, &AWallSpike::RetireSpike, 1.0f, false);
+}
+
+void AWallSpike::RetireSpike()
+{
+	// Pooled spikes go quiet in place; the owning chunk returns them to the pool
+	if (bManagedByPool)
 	{
-		if (IsValid(this))
-		{
-			Destroy();
-		}
-	}, 1.0f, false);
+		DeactivateForPool();
+		SetActorHiddenInGame(true);
+		SetActorEnableCollision(false);
+		SetActorTickEnabled(false);
+		return;
+	}
+
+	Destroy();
+}
+
+void AWallSpike::ResetForReuse()
+{
+	bManagedByPool = true;
+
+	// Drop anything left from the previous chase (pending retire timer, loop audio)
+	DeactivateForPool();
+
+	// Fresh chase state
+	PrimaryDirection = GetPrimaryDirection();
+	CurrentDirection = PrimaryDirection;
+	PlayerSearchTimer = 0.0f;
+	TimeBehindPlayer = 0.0f;
+
+	// Fresh death tracking
+	bHasKilledPlayer = false;
+	bTrackingPlayerDeath = false;
+	PlayerDeathTimer = 0.0f;
+
+	if (ImpactEffect)
+	{
+		ImpactEffect->Deactivate();
+	}
+
+	// Undo RetireSpike
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	SetActorTickEnabled(true);
+}
+
+void AWallSpike::DeactivateForPool()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(DeathDestroyTimerHandle);
+	}
+
+	StopChaseAudio();
+	TargetPlayer = nullptr;
+	bHasTarget = false;
 }
 
 void AWallSpike::NotifyHit(UPrimitiveComponent* MyComp, AActor* Other, UPrimitiveComponent* OtherComp, 
@@ -33,6 +33,14 @@ public:
 	virtual void NotifyHit(UPrimitiveComponent* MyComp, AActor* Other, UPrimitiveComponent* OtherComp, 
 		bool bSelfMoved, FVector HitLocation, FVector HitNormal, FVector NormalImpulse, const FHitResult& Hit) override;
 
+	// POOLING: Called by UProceduralLevelBuilder on every placement (fresh or reused).
+	// Clears target, timers, chase audio, direction and death tracking, and marks the spike
+	// as pool-managed so it retires in place instead of destroying itself.
+	void ResetForReuse();
+
+	// POOLING: Stops timers and chase audio before the spike sleeps in a pool
+	void DeactivateForPool();
+
 protected:
 	// PERFORMANCE: Chasing behavior properties
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Chase Behavior", meta = (ClampMin = "0.0", ClampMax = "2000.0"))
@@ -120,6 +128,9 @@ private:
 	// Timer handle for destruction - stored so it can be canceled on player respawn
 	FTimerHandle DeathDestroyTimerHandle;
 
+	// POOLING: True once placed by UProceduralLevelBuilder - the owning chunk recycles it
+	bool bManagedByPool;
+
 	// PERFORMANCE: Core functionality methods
 	FVector GetPrimaryDirection() const;
 	void UpdateTargetPlayer();
@@ -135,6 +146,9 @@ private:
 	void HandleChaseAudioStart(bool bWasHasTarget);
 	void StopChaseAudio();
 	void ResetPositionBehindPlayer(ARunnerCharacter* Player);
+
+	// Ends this spike's run: destroys it, or hides it until its chunk is recycled if pooled
+	void RetireSpike();
 	
 #if WITH_EDITOR
 	void DrawDebugVisualization();